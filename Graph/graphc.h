@@ -0,0 +1,525 @@
+// graphc.h
+#ifndef GRAPHC_H
+#define GRAPHC_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#include <immintrin.h>
+#define GRAPHC_SSSE3 1
+#endif
+
+#include "grapgh1.h"
+
+/**
+ * @file graphc.h
+ * @brief Compressed, read-only adjacency storage implementing the Graph interface
+ *
+ * Each vertex's sorted neighbor list is stored as gaps packed with group-varint:
+ * one tag byte describes the byte length (1..4) of the next four gaps, followed
+ * by the gap bytes. The first gap is the zigzag-encoded distance from v itself,
+ * so graphs with good vertex locality compress well.
+ *
+ * Layout of one vertex block:
+ *   varint(degree) | group(tag, gaps x4) | group ...
+ * Unused slots of the last group are tagged as 1-byte gaps but take no bytes;
+ * decoders read whatever follows into those lanes and ignore them.
+ *
+ * Block offsets are sampled: a 64-bit base every kOffsetSample vertices plus a
+ * 16-bit delta per vertex (2.125 bytes per vertex instead of 8). A delta that
+ * does not fit is marked kDeltaOverflow and looked up in a small sorted table.
+ *
+ * Groups are decoded with one SSSE3 byte shuffle each. The SSSE3 decoder is
+ * compiled with a target attribute and picked once at run time with
+ * __builtin_cpu_supports("ssse3"), so no -mssse3 is needed; other CPUs use
+ * the scalar loop.
+ *
+ * Traversal: forEachNeighbor is the fast path. first/next also work when
+ * several vertices are iterated at once (e.g. recursive DFS): each vertex keeps
+ * a small resume cursor (16 bytes per vertex, allocated on first use and
+ * counted by memoryBytes()), so
+ * next(v, w) right after returning w decodes a single group. Calling next with
+ * any other w falls back to a rescan of v's list.
+ *
+ * The graph is immutable once built: setEdge/delEdge throw. Edges are
+ * unweighted, so weight() returns 1 for an edge and 0 otherwise.
+ */
+class Graphc : public Graph
+{
+   private:
+    // Bytes appended after the last block so the SIMD decoder may over-read 16 bytes
+    static const int kPadding = 16;
+    // Vertices per sampled base offset
+    static const int kOffsetSample = 64;
+    // offsetDelta value meaning "see offsetOverflow"
+    static const uint16_t kDeltaOverflow = 0xFFFF;
+
+    int numVertices;
+    int numEdges;
+    bool directed;
+    std::vector<uint8_t> data;          // group-varint encoded neighbor lists
+    std::vector<uint64_t> offsetBase;   // offsetBase[v / kOffsetSample] = offset of that sample's first block
+    std::vector<uint16_t> offsetDelta;  // offset of v's block minus its base
+    std::vector<std::pair<int, uint64_t>> offsetOverflow;  // (v, offset) where the delta is >= kDeltaOverflow
+    std::vector<int> mark;              // For marking vertices during traversal
+
+    // first/next resume point of one vertex: the group holding the last returned neighbor
+    struct Cursor
+    {
+        uint64_t group;  // byte offset of that group in data
+        int index;       // position of the neighbor in v's list, -1 if none
+        int value;       // the neighbor itself
+    };
+    std::vector<Cursor> cursors;  // one per vertex, allocated by the first first() call
+
+    // Gaps decoded per decodeGroups call in forEachNeighbor (16 groups)
+    static const int kDecodeBatch = 64;
+
+    void checkVertex(int v) const
+    {
+        if (v < 0 || v >= numVertices)
+        {
+            throw std::out_of_range("Vertex index out of range");
+        }
+    }
+
+    static void putVarint(std::vector<uint8_t>& out, uint32_t x)
+    {
+        while (x >= 0x80)
+        {
+            out.push_back(static_cast<uint8_t>(x | 0x80));
+            x >>= 7;
+        }
+        out.push_back(static_cast<uint8_t>(x));
+    }
+
+    static uint32_t getVarint(const uint8_t*& p)
+    {
+        uint32_t x = 0;
+        int shift = 0;
+        while (*p & 0x80)
+        {
+            x |= static_cast<uint32_t>(*p++ & 0x7F) << shift;
+            shift += 7;
+        }
+        x |= static_cast<uint32_t>(*p++) << shift;
+        return x;
+    }
+
+    static int byteLength(uint32_t x)
+    {
+        if (x < (1u << 8)) return 1;
+        if (x < (1u << 16)) return 2;
+        if (x < (1u << 24)) return 3;
+        return 4;
+    }
+
+    static uint32_t zigzag(int64_t x)
+    {
+        return static_cast<uint32_t>((x << 1) ^ (x >> 63));
+    }
+
+    static int64_t unzigzag(uint32_t x)
+    {
+        return static_cast<int64_t>(x >> 1) ^ -static_cast<int64_t>(x & 1);
+    }
+
+    // Start of v's block
+    const uint8_t* block(int v) const
+    {
+        uint16_t d = offsetDelta[v];
+        if (d != kDeltaOverflow)
+        {
+            return data.data() + offsetBase[v / kOffsetSample] + d;
+        }
+        auto it = std::lower_bound(offsetOverflow.begin(), offsetOverflow.end(), std::make_pair(v, uint64_t(0)));
+        return data.data() + it->second;
+    }
+
+    // Append v's sorted, de-duplicated neighbor list as one block
+    static void encodeList(std::vector<uint8_t>& out, int v, const int* nbr, int deg)
+    {
+        putVarint(out, static_cast<uint32_t>(deg));
+        uint32_t gaps[4];
+        for (int i = 0; i < deg; i += 4)
+        {
+            int cnt = std::min(4, deg - i);
+            uint8_t tag = 0;
+            for (int k = 0; k < 4; k++)
+            {
+                if (k < cnt)
+                {
+                    int j = i + k;
+                    gaps[k] = j == 0 ? zigzag(static_cast<int64_t>(nbr[0]) - v)
+                                     : static_cast<uint32_t>(nbr[j] - nbr[j - 1]);
+                }
+                else
+                {
+                    gaps[k] = 0;  // unused slot of the last group: tagged 1 byte, nothing written
+                }
+                tag |= static_cast<uint8_t>((byteLength(gaps[k]) - 1) << (2 * k));
+            }
+            out.push_back(tag);
+            for (int k = 0; k < cnt; k++)
+            {
+                int len = byteLength(gaps[k]);
+                for (int b = 0; b < len; b++)
+                {
+                    out.push_back(static_cast<uint8_t>(gaps[k] >> (8 * b)));
+                }
+            }
+        }
+    }
+
+    // Decode `groups` consecutive groups into out[0 .. 4 * groups); returns pointer past them
+    static const uint8_t* decodeGroupsScalar(const uint8_t* p, int groups, uint32_t* out)
+    {
+        for (int g = 0; g < groups; g++)
+        {
+            uint8_t tag = *p++;
+            for (int k = 0; k < 4; k++)
+            {
+                int len = ((tag >> (2 * k)) & 3) + 1;
+                uint32_t x = 0;
+                for (int b = 0; b < len; b++)
+                {
+                    x |= static_cast<uint32_t>(p[b]) << (8 * b);
+                }
+                out[4 * g + k] = x;
+                p += len;
+            }
+        }
+        return p;
+    }
+
+#ifdef GRAPHC_SSSE3
+    // Shuffle mask and encoded length for each of the 256 tag bytes
+    struct GroupTable
+    {
+        alignas(16) uint8_t mask[256][16];
+        uint8_t length[256];
+
+        GroupTable()
+        {
+            for (int tag = 0; tag < 256; tag++)
+            {
+                int pos = 0;
+                for (int k = 0; k < 4; k++)
+                {
+                    int len = ((tag >> (2 * k)) & 3) + 1;
+                    for (int b = 0; b < 4; b++)
+                    {
+                        mask[tag][4 * k + b] = b < len ? static_cast<uint8_t>(pos + b) : 0x80;
+                    }
+                    pos += len;
+                }
+                length[tag] = static_cast<uint8_t>(pos);
+            }
+        }
+    };
+
+    static const GroupTable& groupTable()
+    {
+        static const GroupTable table;
+        return table;
+    }
+
+    static bool hasSsse3()
+    {
+        static const bool has = __builtin_cpu_supports("ssse3");
+        return has;
+    }
+
+    // One shuffle per group; may read up to 16 bytes past a group, covered by kPadding
+    __attribute__((target("ssse3"))) static const uint8_t* decodeGroupsSsse3(const uint8_t* p, int groups,
+                                                                             uint32_t* out)
+    {
+        const GroupTable& t = groupTable();
+        for (int g = 0; g < groups; g++)
+        {
+            uint8_t tag = *p++;
+            __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+            __m128i m = _mm_load_si128(reinterpret_cast<const __m128i*>(t.mask[tag]));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 4 * g), _mm_shuffle_epi8(in, m));
+            p += t.length[tag];
+        }
+        return p;
+    }
+#endif
+
+    static const uint8_t* decodeGroups(const uint8_t* p, int groups, uint32_t* out)
+    {
+#ifdef GRAPHC_SSSE3
+        if (hasSsse3()) return decodeGroupsSsse3(p, groups, out);
+#endif
+        return decodeGroupsScalar(p, groups, out);
+    }
+
+    // Call f(w) for neighbors of v in increasing order until f returns false
+    template <typename F>
+    void visitNeighbors(int v, F&& f) const
+    {
+        checkVertex(v);
+        const uint8_t* p = block(v);
+        int deg = static_cast<int>(getVarint(p));
+        int64_t prev = v;
+        uint32_t gaps[kDecodeBatch];
+        for (int i = 0; i < deg; i += kDecodeBatch)
+        {
+            int cnt = std::min(kDecodeBatch, deg - i);
+            p = decodeGroups(p, (cnt + 3) / 4, gaps);
+            for (int k = 0; k < cnt; k++)
+            {
+                prev = (i + k == 0) ? v + unzigzag(gaps[0]) : prev + gaps[k];
+                if (!f(static_cast<int>(prev))) return;
+            }
+        }
+    }
+
+    // Rebuild data and the offset index from per-vertex sorted adjacency lists
+    void encodeAll(const std::vector<std::vector<int>>& adj)
+    {
+        data.clear();
+        offsetBase.assign((numVertices + kOffsetSample - 1) / kOffsetSample, 0);
+        offsetDelta.assign(numVertices, 0);
+        offsetOverflow.clear();
+        numEdges = 0;
+        for (int v = 0; v < numVertices; v++)
+        {
+            if (v % kOffsetSample == 0)
+            {
+                offsetBase[v / kOffsetSample] = data.size();
+            }
+            uint64_t delta = data.size() - offsetBase[v / kOffsetSample];
+            if (delta < kDeltaOverflow)
+            {
+                offsetDelta[v] = static_cast<uint16_t>(delta);
+            }
+            else
+            {
+                offsetDelta[v] = kDeltaOverflow;
+                offsetOverflow.push_back({v, data.size()});
+            }
+            encodeList(data, v, adj[v].data(), static_cast<int>(adj[v].size()));
+            numEdges += static_cast<int>(adj[v].size());
+        }
+        offsetOverflow.shrink_to_fit();
+        data.resize(data.size() + kPadding, 0);
+        data.shrink_to_fit();
+        if (!directed)
+        {
+            numEdges /= 2;
+        }
+        cursors.clear();
+    }
+
+   public:
+    // Constructor: an edgeless graph with n vertices
+    Graphc(int n = 0, bool isDirected = false)
+        : numVertices(0), numEdges(0), directed(isDirected)
+    {
+        Init(n);
+    }
+
+    // Constructor: build from an edge list (duplicates and self-loop repeats are dropped)
+    Graphc(int n, const std::vector<std::pair<int, int>>& edges, bool isDirected = false)
+        : numVertices(0), numEdges(0), directed(isDirected)
+    {
+        build(n, edges);
+    }
+
+    // Replace the graph with the given edge list
+    void build(int n, const std::vector<std::pair<int, int>>& edges)
+    {
+        if (n < 0)
+        {
+            throw std::invalid_argument("Number of vertices cannot be negative");
+        }
+        numVertices = n;
+        std::vector<std::vector<int>> adj(n);
+        for (const auto& [u, v] : edges)
+        {
+            checkVertex(u);
+            checkVertex(v);
+            adj[u].push_back(v);
+            if (!directed && u != v)
+            {
+                adj[v].push_back(u);
+            }
+        }
+        for (auto& list : adj)
+        {
+            std::sort(list.begin(), list.end());
+            list.erase(std::unique(list.begin(), list.end()), list.end());
+        }
+        encodeAll(adj);
+        mark.assign(n, 0);
+    }
+
+    // Initialize a graph with n vertices and no edges
+    virtual void Init(int n) override
+    {
+        build(n, {});
+    }
+
+    // Return the number of vertices
+    virtual int n() override
+    {
+        return numVertices;
+    }
+
+    // Return the number of edges
+    virtual int e() override
+    {
+        return numEdges;
+    }
+
+    // Number of neighbors of v (reads only the block header)
+    int degree(int v) const
+    {
+        checkVertex(v);
+        const uint8_t* p = block(v);
+        return static_cast<int>(getVarint(p));
+    }
+
+    // Call f(w) for every neighbor w of v in increasing order; this is the fast path for BFS
+    template <typename F>
+    void forEachNeighbor(int v, F&& f) const
+    {
+        visitNeighbors(v, [&f](int w) {
+            f(w);
+            return true;
+        });
+    }
+
+    // Decode v's neighbor list into out (cleared first)
+    void neighbors(int v, std::vector<int>& out) const
+    {
+        out.clear();
+        out.reserve(degree(v));
+        forEachNeighbor(v, [&out](int w) { out.push_back(w); });
+    }
+
+    // Return v's first neighbor
+    virtual int first(int v) override
+    {
+        checkVertex(v);
+        if (cursors.empty())
+        {
+            cursors.assign(numVertices, Cursor{0, -1, 0});
+        }
+        const uint8_t* p = block(v);
+        int deg = static_cast<int>(getVarint(p));
+        if (deg == 0)
+        {
+            cursors[v].index = -1;
+            return numVertices;
+        }
+        uint32_t gaps[4];
+        decodeGroups(p, 1, gaps);
+        int w = static_cast<int>(v + unzigzag(gaps[0]));
+        cursors[v] = {static_cast<uint64_t>(p - data.data()), 0, w};
+        return w;
+    }
+
+    // Return v's next neighbor after w
+    virtual int next(int v, int w) override
+    {
+        checkVertex(v);
+        checkVertex(w);
+        if (cursors.empty() || cursors[v].index < 0 || cursors[v].value != w)
+        {
+            // Not resuming from the last returned neighbor: walk the list from the start
+            int x = first(v);
+            while (x < w) x = next(v, x);
+            return x == w ? next(v, w) : numVertices;
+        }
+        Cursor& c = cursors[v];
+        const uint8_t* p = block(v);
+        int deg = static_cast<int>(getVarint(p));
+        if (c.index + 1 >= deg)
+        {
+            c.index = -1;
+            return numVertices;
+        }
+        uint32_t gaps[4];
+        const uint8_t* group = data.data() + c.group;
+        const uint8_t* after = decodeGroups(group, 1, gaps);
+        int k = (c.index + 1) % 4;
+        if (k == 0)
+        {
+            // The next neighbor starts a new group
+            group = after;
+            decodeGroups(group, 1, gaps);
+        }
+        c.group = static_cast<uint64_t>(group - data.data());
+        c.index++;
+        c.value += static_cast<int>(gaps[k]);
+        return c.value;
+    }
+
+    // The compressed form is read-only
+    virtual void setEdge(int, int, int) override
+    {
+        throw std::logic_error("Graphc is immutable; rebuild it from an edge list");
+    }
+
+    virtual void delEdge(int, int) override
+    {
+        throw std::logic_error("Graphc is immutable; rebuild it from an edge list");
+    }
+
+    // Determine if an edge is in a graph
+    virtual bool isEdge(int i, int j) override
+    {
+        checkVertex(j);
+        bool found = false;
+        // Lists are sorted: stop at the first neighbor >= j
+        visitNeighbors(i, [&found, j](int w) {
+            found = w == j;
+            return w < j;
+        });
+        return found;
+    }
+
+    // Edges are unweighted: 1 if present, 0 otherwise
+    virtual int weight(int v1, int v2) override
+    {
+        return isEdge(v1, v2) ? 1 : 0;
+    }
+
+    // Get mark for vertex v
+    virtual int getMark(int v) override
+    {
+        checkVertex(v);
+        return mark[v];
+    }
+
+    // Set mark for vertex v
+    virtual void setMark(int v, int val) override
+    {
+        checkVertex(v);
+        mark[v] = val;
+    }
+
+    // Check if graph is directed
+    bool isDirected() const
+    {
+        return directed;
+    }
+
+    // Bytes used by the adjacency structure (encoded lists, offset index and first/next cursors)
+    size_t memoryBytes() const
+    {
+        return data.size() * sizeof(uint8_t) + offsetBase.size() * sizeof(uint64_t) +
+               offsetDelta.size() * sizeof(uint16_t) + offsetOverflow.size() * sizeof(offsetOverflow[0]) +
+               cursors.size() * sizeof(Cursor);
+    }
+};
+
+#endif  // GRAPHC_H
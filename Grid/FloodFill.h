@@ -0,0 +1,206 @@
+// FloodFill.h
+#ifndef FLOODFILL_H
+#define FLOODFILL_H
+
+#include <vector>
+
+#include "BitGrid.h"
+
+/**
+ * @file FloodFill.h
+ * @brief 扫描线（span）种子填充，四连通，不递归
+ *
+ * 算法来自 Heckbert 的 "A Seed Fill Algorithm"（Graphics Gems）：
+ * 栈里存的是“某一行上刚填好的一段 [xl, xr] 以及要去探索的方向 dy”，
+ * 每次弹出后在相邻行上向左右整段延伸并填充，只有在段的两端“漏”出去时才反向压栈。
+ * 栈中保存的是段而不是格子，一片规则的大区域只需要与高度同阶的栈空间。
+ *
+ * 网格的读写通过 Surface 适配：
+ *   rows(), cols()
+ *   inside(r, c)          该格是否需要填充
+ *   scanLeft(r, c)        c 在区域内时，返回向左延伸到的最小列
+ *   scanRight(r, c)       返回从 c 开始第一个不在区域内的列（可能等于 cols()）
+ *   nextInside(r, c, x2)  返回 [c, x2] 中第一个在区域内的列，没有则返回 > x2 的值
+ *   fill(r, a, b)         填充 [a, b)，填充后这些格子不再 inside
+ */
+
+template <typename Surface>
+long long scanlineFill(Surface& s, int r, int c)
+{
+    if (r < 0 || r >= s.rows() || c < 0 || c >= s.cols() || !s.inside(r, c)) return 0;
+
+    struct Span
+    {
+        int y, xl, xr, dy;  // 第 y 行的 [xl, xr] 已填好，接下来探索第 y + dy 行
+    };
+    std::vector<Span> stack;
+    auto push = [&](int y, int xl, int xr, int dy) {
+        if (y + dy >= 0 && y + dy < s.rows()) stack.push_back({y, xl, xr, dy});
+    };
+
+    long long filled = 0;
+    push(r, c, c, 1);
+    push(r + 1, c, c, -1);  // 种子所在的行，最先弹出
+    while (!stack.empty())
+    {
+        Span sp = stack.back();
+        stack.pop_back();
+        int y = sp.y + sp.dy, x1 = sp.xl, x2 = sp.xr, dy = sp.dy;
+        int x = x1;
+        if (s.inside(y, x1))
+        {
+            // 与 x1 相连的整段，向左可能漏出上一行的范围
+            int l = s.scanLeft(y, x1), e = s.scanRight(y, x1);
+            s.fill(y, l, e);
+            filled += e - l;
+            if (l < x1) push(y, l, x1 - 1, -dy);
+            push(y, l, e - 1, dy);
+            if (e > x2 + 1) push(y, x2 + 1, e - 1, -dy);
+            x = e;
+        }
+        // [x1, x2] 范围内剩下的段
+        for (x = s.nextInside(y, x + 1, x2); x <= x2; x = s.nextInside(y, x + 1, x2))
+        {
+            int e = s.scanRight(y, x);
+            s.fill(y, x, e);
+            filled += e - x;
+            push(y, x, e - 1, dy);
+            if (e > x2 + 1) push(y, x2 + 1, e - 1, -dy);
+            x = e;
+        }
+    }
+    return filled;
+}
+
+// vector<vector<char>> 网格：把与种子相连、值为 from 的格子改成 to
+struct CharGridSurface
+{
+    std::vector<std::vector<char>>& g;
+    char from, to;
+
+    int rows() const
+    {
+        return static_cast<int>(g.size());
+    }
+    int cols() const
+    {
+        return g.empty() ? 0 : static_cast<int>(g[0].size());
+    }
+    bool inside(int r, int c) const
+    {
+        return g[r][c] == from;
+    }
+    int scanLeft(int r, int c) const
+    {
+        while (c > 0 && g[r][c - 1] == from) c--;
+        return c;
+    }
+    int scanRight(int r, int c) const
+    {
+        int n = cols();
+        while (c < n && g[r][c] == from) c++;
+        return c;
+    }
+    int nextInside(int r, int c, int x2) const
+    {
+        while (c <= x2 && g[r][c] != from) c++;
+        return c;
+    }
+    void fill(int r, int a, int b)
+    {
+        for (int c = a; c < b; c++) g[r][c] = to;
+    }
+};
+
+// BitGrid：清除与种子相连的 1；段的延伸和填充都按 64 位字处理
+struct BitGridSurface
+{
+    BitGrid& g;
+
+    int rows() const
+    {
+        return g.rows();
+    }
+    int cols() const
+    {
+        return g.cols();
+    }
+    bool inside(int r, int c) const
+    {
+        return g.get(r, c);
+    }
+    int scanLeft(int r, int c) const
+    {
+        const uint64_t* w = g.row(r);
+        int i = c >> 6;
+        uint64_t upTo = (c & 63) == 63 ? ~uint64_t(0) : (uint64_t(2) << (c & 63)) - 1;
+        uint64_t zeros = ~w[i] & upTo;  // c 及其左边的 0
+        while (zeros == 0)
+        {
+            if (i == 0) return 0;
+            zeros = ~w[--i];
+        }
+        return i * 64 + (63 - __builtin_clzll(zeros)) + 1;
+    }
+    int scanRight(int r, int c) const
+    {
+        if (c >= g.cols()) return g.cols();
+        const uint64_t* w = g.row(r);
+        int i = c >> 6, words = g.wordsPerRow();
+        uint64_t zeros = ~w[i] & (~uint64_t(0) << (c & 63));
+        while (zeros == 0)
+        {
+            if (++i == words) return g.cols();
+            zeros = ~w[i];
+        }
+        int e = i * 64 + __builtin_ctzll(zeros);
+        return e < g.cols() ? e : g.cols();
+    }
+    int nextInside(int r, int c, int x2) const
+    {
+        if (c > x2) return c;
+        const uint64_t* w = g.row(r);
+        int i = c >> 6, last = x2 >> 6;
+        uint64_t ones = w[i] & (~uint64_t(0) << (c & 63));
+        while (ones == 0)
+        {
+            if (++i > last) return x2 + 1;
+            ones = w[i];
+        }
+        int x = i * 64 + __builtin_ctzll(ones);
+        return x <= x2 ? x : x2 + 1;
+    }
+    void fill(int r, int a, int b)
+    {
+        uint64_t* w = g.row(r);
+        while (a < b)
+        {
+            int i = a >> 6, lo = a & 63, hi = (b - i * 64) < 64 ? (b - i * 64) : 64;
+            uint64_t mask = (hi == 64 ? ~uint64_t(0) : (uint64_t(1) << hi) - 1) & (~uint64_t(0) << lo);
+            w[i] &= ~mask;
+            a = i * 64 + hi;
+        }
+    }
+};
+
+/**
+ * @brief 把 (r, c) 所在的、值为 from 的四连通区域改成 to，返回填充的格子数
+ */
+inline long long floodFill(std::vector<std::vector<char>>& grid, int r, int c, char from = '1',
+                           char to = '0')
+{
+    if (from == to) return 0;
+    CharGridSurface s{grid, from, to};
+    return scanlineFill(s, r, c);
+}
+
+/**
+ * @brief 清除 BitGrid 中 (r, c) 所在的 1 区域，返回清除的格子数
+ */
+inline long long floodFill(BitGrid& grid, int r, int c)
+{
+    BitGridSurface s{grid};
+    return scanlineFill(s, r, c);
+}
+
+#endif  // FLOODFILL_H
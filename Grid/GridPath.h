@@ -0,0 +1,394 @@
+// GridPath.h
+#ifndef GRIDPATH_H
+#define GRIDPATH_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <queue>
+#include <vector>
+
+/**
+ * @file GridPath.h
+ * @brief 四连通网格寻路：BFS、双向 BFS、A*（曼哈顿距离）和 Jump Point Search
+ *
+ * 网格用一维数组按行存储，格子编号 idx = r * cols + c。
+ * 约定与 PTAtest/9.cpp 的迷宫一致：值为 1 的格子是墙，其余格子都能走，每步代价为 1。
+ *
+ * GridPathFinder 在多次查询之间复用内部数组，并用“时间戳”标记访问状态，
+ * 所以每次查询不需要 O(rows * cols) 的清零。
+ */
+
+/**
+ * @brief 一维存储的网格地图
+ */
+struct GridMap
+{
+    int rows = 0, cols = 0;
+    std::vector<uint8_t> cell;  // cell[r * cols + c]，1 表示墙
+
+    GridMap() = default;
+    GridMap(int r, int c) : rows(r), cols(c), cell(static_cast<size_t>(r) * c, 0)
+    {
+    }
+
+    int index(int r, int c) const
+    {
+        return r * cols + c;
+    }
+
+    bool passable(int r, int c) const
+    {
+        return r >= 0 && r < rows && c >= 0 && c < cols && cell[index(r, c)] != 1;
+    }
+};
+
+class GridPathFinder
+{
+   private:
+    const GridMap& g;
+    int size;
+    uint32_t stamp = 0;
+    std::vector<uint32_t> seenA, seenB;  // 正向 / 反向搜索的访问时间戳
+    std::vector<uint32_t> closed;        // A* / JPS 的关闭表时间戳
+    std::vector<int> distA, distB;       // 距离（A* 里是 g 值）
+    std::vector<int> parentA, parentB;   // 前驱格子，用于还原路径
+
+    struct Node
+    {
+        int f, g, idx;
+        bool operator>(const Node& o) const
+        {
+            // f 相同时优先扩展 g 大的（离终点更近）
+            return f != o.f ? f > o.f : g < o.g;
+        }
+    };
+    using OpenList = std::priority_queue<Node, std::vector<Node>, std::greater<Node>>;
+
+    static constexpr int dr[4] = {-1, 1, 0, 0};
+    static constexpr int dc[4] = {0, 0, -1, 1};
+
+    void nextStamp()
+    {
+        if (++stamp == 0)  // 溢出后整体清零一次
+        {
+            std::fill(seenA.begin(), seenA.end(), 0);
+            std::fill(seenB.begin(), seenB.end(), 0);
+            std::fill(closed.begin(), closed.end(), 0);
+            stamp = 1;
+        }
+    }
+
+    bool open(int idx) const
+    {
+        return g.cell[idx] != 1;
+    }
+
+    int manhattan(int a, int b) const
+    {
+        return std::abs(a / g.cols - b / g.cols) + std::abs(a % g.cols - b % g.cols);
+    }
+
+    bool valid(int s, int t) const
+    {
+        return s >= 0 && s < size && t >= 0 && t < size && open(s) && open(t);
+    }
+
+    // 沿 parent 从 t 回到 s，得到 s -> t 的格子序列
+    void tracePath(const std::vector<int>& parent, int s, int t, std::vector<int>& out) const
+    {
+        out.clear();
+        for (int v = t; v != s; v = parent[v]) out.push_back(v);
+        out.push_back(s);
+        std::reverse(out.begin(), out.end());
+    }
+
+    // 把跳点之间的直线段补全成逐格路径
+    void expandJumps(int s, int t, std::vector<int>& out) const
+    {
+        std::vector<int> jumps;
+        tracePath(parentA, s, t, jumps);
+        out.clear();
+        out.push_back(s);
+        for (size_t i = 1; i < jumps.size(); i++)
+        {
+            int a = jumps[i - 1], b = jumps[i];
+            int step = (a / g.cols == b / g.cols) ? (b > a ? 1 : -1) : (b > a ? g.cols : -g.cols);
+            for (int v = a + step; v != b; v += step) out.push_back(v);
+            out.push_back(b);
+        }
+    }
+
+    // 水平跳跃：遇到目标或“强迫邻居”就停下，撞墙返回 -1
+    int jumpHorizontal(int r, int c, int dx, int t) const
+    {
+        while (true)
+        {
+            int pc = c;
+            c += dx;
+            if (!g.passable(r, c)) return -1;
+            int idx = g.index(r, c);
+            if (idx == t) return idx;
+            // 上/下方可走而来路的上/下方是墙：这里必须停下来拐弯
+            if ((g.passable(r - 1, c) && !g.passable(r - 1, pc)) ||
+                (g.passable(r + 1, c) && !g.passable(r + 1, pc)))
+            {
+                return idx;
+            }
+        }
+    }
+
+    // 垂直跳跃：每走一步都向左右做一次水平跳跃，能找到跳点就在此停下
+    int jumpVertical(int r, int c, int dy, int t) const
+    {
+        while (true)
+        {
+            r += dy;
+            if (!g.passable(r, c)) return -1;
+            int idx = g.index(r, c);
+            if (idx == t) return idx;
+            if (jumpHorizontal(r, c, -1, t) != -1 || jumpHorizontal(r, c, 1, t) != -1)
+            {
+                return idx;
+            }
+        }
+    }
+
+   public:
+    explicit GridPathFinder(const GridMap& map)
+        : g(map),
+          size(map.rows * map.cols),
+          seenA(size, 0),
+          seenB(size, 0),
+          closed(size, 0),
+          distA(size),
+          distB(size),
+          parentA(size),
+          parentB(size)
+    {
+    }
+
+    /**
+     * @brief 普通单向 BFS（与 PTAtest/9.cpp 相同的语义，作为参照）
+     * @return 最短步数，不可达返回 -1；path 非空时写入 s..t 的格子序列
+     */
+    int bfs(int s, int t, std::vector<int>* path = nullptr)
+    {
+        if (!valid(s, t)) return -1;
+        nextStamp();
+        std::vector<int> q;
+        q.reserve(1024);
+        q.push_back(s);
+        seenA[s] = stamp;
+        distA[s] = 0;
+        for (size_t head = 0; head < q.size(); head++)
+        {
+            int u = q[head];
+            if (u == t)
+            {
+                if (path) tracePath(parentA, s, t, *path);
+                return distA[u];
+            }
+            int r = u / g.cols, c = u % g.cols;
+            for (int k = 0; k < 4; k++)
+            {
+                if (!g.passable(r + dr[k], c + dc[k])) continue;
+                int v = g.index(r + dr[k], c + dc[k]);
+                if (seenA[v] == stamp) continue;
+                seenA[v] = stamp;
+                distA[v] = distA[u] + 1;
+                parentA[v] = u;
+                q.push_back(v);
+            }
+        }
+        return -1;
+    }
+
+    /**
+     * @brief 双向 BFS：每次扩展较小的那一侧的一整层，两侧相遇后取本层的最优解
+     */
+    int bidirectionalBFS(int s, int t, std::vector<int>* path = nullptr)
+    {
+        if (!valid(s, t)) return -1;
+        if (s == t)
+        {
+            if (path) *path = {s};
+            return 0;
+        }
+        nextStamp();
+        std::vector<int> front = {s}, back = {t}, nextLevel;
+        seenA[s] = stamp, distA[s] = 0;
+        seenB[t] = stamp, distB[t] = 0;
+        int best = -1, meetU = -1, meetV = -1;
+
+        while (!front.empty() && !back.empty())
+        {
+            bool forward = front.size() <= back.size();
+            std::vector<int>& cur = forward ? front : back;
+            std::vector<uint32_t>& seen = forward ? seenA : seenB;
+            std::vector<uint32_t>& other = forward ? seenB : seenA;
+            std::vector<int>& dist = forward ? distA : distB;
+            std::vector<int>& odist = forward ? distB : distA;
+            std::vector<int>& parent = forward ? parentA : parentB;
+
+            nextLevel.clear();
+            for (int u : cur)
+            {
+                int r = u / g.cols, c = u % g.cols;
+                for (int k = 0; k < 4; k++)
+                {
+                    if (!g.passable(r + dr[k], c + dc[k])) continue;
+                    int v = g.index(r + dr[k], c + dc[k]);
+                    if (other[v] == stamp)
+                    {
+                        int d = dist[u] + 1 + odist[v];
+                        if (best == -1 || d < best)
+                        {
+                            best = d;
+                            // 统一记成“正向一侧的 u，反向一侧的 v”
+                            meetU = forward ? u : v;
+                            meetV = forward ? v : u;
+                        }
+                    }
+                    if (seen[v] == stamp) continue;
+                    seen[v] = stamp;
+                    dist[v] = dist[u] + 1;
+                    parent[v] = u;
+                    nextLevel.push_back(v);
+                }
+            }
+            if (best != -1) break;
+            cur.swap(nextLevel);
+        }
+
+        if (best != -1 && path)
+        {
+            tracePath(parentA, s, meetU, *path);
+            for (int v = meetV; v != t; v = parentB[v]) path->push_back(v);
+            path->push_back(t);
+        }
+        return best;
+    }
+
+    /**
+     * @brief A* 搜索，启发函数为曼哈顿距离（四连通下是一致的，第一次出队即最优）
+     */
+    int aStar(int s, int t, std::vector<int>* path = nullptr)
+    {
+        if (!valid(s, t)) return -1;
+        nextStamp();
+        OpenList open;
+        seenA[s] = stamp;
+        distA[s] = 0;
+        open.push({manhattan(s, t), 0, s});
+        while (!open.empty())
+        {
+            Node cur = open.top();
+            open.pop();
+            int u = cur.idx;
+            if (closed[u] == stamp || cur.g != distA[u]) continue;
+            closed[u] = stamp;
+            if (u == t)
+            {
+                if (path) tracePath(parentA, s, t, *path);
+                return cur.g;
+            }
+            int r = u / g.cols, c = u % g.cols;
+            for (int k = 0; k < 4; k++)
+            {
+                if (!g.passable(r + dr[k], c + dc[k])) continue;
+                int v = g.index(r + dr[k], c + dc[k]);
+                int ng = cur.g + 1;
+                if (seenA[v] == stamp && distA[v] <= ng) continue;
+                seenA[v] = stamp;
+                distA[v] = ng;
+                parentA[v] = u;
+                open.push({ng + manhattan(v, t), ng, v});
+            }
+        }
+        return -1;
+    }
+
+    /**
+     * @brief 四连通网格上的 Jump Point Search
+     *
+     * 规范路径为“先竖直后水平”：水平移动只能继续水平，除非遇到强迫邻居；
+     * 竖直移动可以继续竖直，也可以向左右两侧展开。只有跳点进入开放表，
+     * 空旷区域里一次跳跃就能跨过整段走廊。
+     */
+    int jumpPointSearch(int s, int t, std::vector<int>* path = nullptr)
+    {
+        if (!valid(s, t)) return -1;
+        nextStamp();
+        OpenList open;
+        seenA[s] = stamp;
+        distA[s] = 0;
+        parentA[s] = s;
+        open.push({manhattan(s, t), 0, s});
+        while (!open.empty())
+        {
+            Node cur = open.top();
+            open.pop();
+            int u = cur.idx;
+            if (closed[u] == stamp || cur.g != distA[u]) continue;
+            closed[u] = stamp;
+            if (u == t)
+            {
+                if (path) expandJumps(s, t, *path);
+                return cur.g;
+            }
+
+            int r = u / g.cols, c = u % g.cols;
+            int pr = parentA[u] / g.cols, pc = parentA[u] % g.cols;
+            bool isStart = u == s;
+            bool cameVertical = !isStart && pc == c;
+            int dy = cameVertical ? (r > pr ? 1 : -1) : 0;
+            int dx = (!isStart && !cameVertical) ? (c > pc ? 1 : -1) : 0;
+
+            // 剪枝后的方向集合
+            int dirs[4][2];
+            int nd = 0;
+            if (isStart)
+            {
+                dirs[nd][0] = -1, dirs[nd++][1] = 0;
+                dirs[nd][0] = 1, dirs[nd++][1] = 0;
+                dirs[nd][0] = 0, dirs[nd++][1] = -1;
+                dirs[nd][0] = 0, dirs[nd++][1] = 1;
+            }
+            else if (cameVertical)
+            {
+                dirs[nd][0] = dy, dirs[nd++][1] = 0;
+                dirs[nd][0] = 0, dirs[nd++][1] = -1;
+                dirs[nd][0] = 0, dirs[nd++][1] = 1;
+            }
+            else
+            {
+                dirs[nd][0] = 0, dirs[nd++][1] = dx;
+                if (g.passable(r - 1, c) && !g.passable(r - 1, c - dx))
+                {
+                    dirs[nd][0] = -1, dirs[nd++][1] = 0;
+                }
+                if (g.passable(r + 1, c) && !g.passable(r + 1, c - dx))
+                {
+                    dirs[nd][0] = 1, dirs[nd++][1] = 0;
+                }
+            }
+
+            for (int k = 0; k < nd; k++)
+            {
+                int v = dirs[k][0] != 0 ? jumpVertical(r, c, dirs[k][0], t)
+                                        : jumpHorizontal(r, c, dirs[k][1], t);
+                if (v == -1) continue;
+                int ng = cur.g + manhattan(u, v);
+                if (seenA[v] == stamp && distA[v] <= ng) continue;
+                seenA[v] = stamp;
+                distA[v] = ng;
+                parentA[v] = u;
+                open.push({ng + manhattan(v, t), ng, v});
+            }
+        }
+        return -1;
+    }
+};
+
+#endif  // GRIDPATH_H
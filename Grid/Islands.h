@@ -0,0 +1,65 @@
+// Islands.h
+#ifndef ISLANDS_H
+#define ISLANDS_H
+
+#include <vector>
+
+#include "../Union_Find/DisjointSet.h"
+#include "BitGrid.h"
+
+/**
+ * @file Islands.h
+ * @brief 基于 1 段（run）的岛屿计数（四连通），对应 Leetcode/200.nums_of_Islands.cpp
+ *
+ * 不再逐格 BFS：每一行先按字抽出所有 1 段，每个段是一个并查集元素；
+ * 相邻两行中列区间有重叠的段属于同一个岛，合并即可。
+ * 岛屿数 = 并查集里剩下的集合数。工作量与段数成正比，整片陆地只算一个段。
+ */
+
+struct Run
+{
+    int begin, end;  // 列区间 [begin, end)
+    int label;       // 并查集中的编号
+};
+
+/**
+ * @brief 把当前行的段和上一行的段做双指针扫描，列区间重叠就合并
+ */
+inline void mergeRows(const std::vector<Run>& prev, const std::vector<Run>& cur, DisjointSet& dsu)
+{
+    size_t i = 0, j = 0;
+    while (i < prev.size() && j < cur.size())
+    {
+        if (prev[i].begin < cur[j].end && cur[j].begin < prev[i].end)
+        {
+            dsu.unite(prev[i].label, cur[j].label);
+        }
+        // 先结束的那个段不会再和后面的段重叠
+        if (prev[i].end < cur[j].end) i++;
+        else j++;
+    }
+}
+
+/**
+ * @brief 统计 BitGrid 中四连通的岛屿个数
+ */
+inline int numIslands(const BitGrid& grid)
+{
+    int words = grid.wordsPerRow();
+    int total = 0;
+    for (int r = 0; r < grid.rows(); r++) total += countRuns(grid.row(r), words);
+
+    DisjointSet dsu(total);
+    std::vector<Run> prev, cur;
+    int next = 0;
+    for (int r = 0; r < grid.rows(); r++)
+    {
+        cur.clear();
+        forEachRun(grid.row(r), words, [&](int b, int e) { cur.push_back({b, e, next++}); });
+        mergeRows(prev, cur, dsu);
+        prev.swap(cur);
+    }
+    return dsu.setCount();
+}
+
+#endif  // ISLANDS_H
@@ -0,0 +1,301 @@
+// MazeIndex.h
+#ifndef MAZEINDEX_H
+#define MAZEINDEX_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <queue>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "GridPath.h"
+
+/**
+ * @file MazeIndex.h
+ * @brief 静态迷宫的距离场索引，用于大量重复的起点/终点查询
+ *
+ * 预先从若干源点各做一次 BFS，保存整张图到该源点的距离场：
+ * - 源点是固定的目标点时，查询 (s, 目标) 直接查表，O(1)；
+ * - 源点是地标（landmark）时，用 ALT 下界 max_i |d_i(t) - d_i(v)| 引导 A*，
+ *   比曼哈顿距离紧得多，在迂回的迷宫里扩展的格子少很多。
+ * 地标用“最远点”策略选取。索引可以存盘，地图不变时跨进程复用；
+ * 读入时会校验行列数和地图校验和，地图不匹配就抛异常。
+ */
+class MazeIndex
+{
+   public:
+    static const uint32_t kUnreachable = UINT32_MAX;
+
+   private:
+    const GridMap& g;
+    int size;
+    std::vector<int> sources;
+    std::vector<std::vector<uint32_t>> field;  // field[i][v] = v 到 sources[i] 的步数
+    std::vector<int> sourceSlot;               // 格子 -> 它在 sources 中的下标，不是源点为 -1
+
+    // ALT A* 的复用数组
+    uint32_t stamp = 0;
+    std::vector<uint32_t> seen, closed;
+    std::vector<uint32_t> dist;
+
+    static constexpr int dr[4] = {-1, 1, 0, 0};
+    static constexpr int dc[4] = {0, 0, -1, 1};
+
+    void bfsField(int src, std::vector<uint32_t>& d) const
+    {
+        d.assign(size, kUnreachable);
+        std::vector<int> q;
+        q.reserve(1024);
+        d[src] = 0;
+        q.push_back(src);
+        for (size_t head = 0; head < q.size(); head++)
+        {
+            int u = q[head];
+            int r = u / g.cols, c = u % g.cols;
+            for (int k = 0; k < 4; k++)
+            {
+                if (!g.passable(r + dr[k], c + dc[k])) continue;
+                int v = g.index(r + dr[k], c + dc[k]);
+                if (d[v] != kUnreachable) continue;
+                d[v] = d[u] + 1;
+                q.push_back(v);
+            }
+        }
+    }
+
+    void addSource(int src)
+    {
+        if (src < 0 || src >= size || g.cell[src] == 1)
+        {
+            throw std::invalid_argument("Source cell must be a passable cell");
+        }
+        if (sourceSlot[src] >= 0) return;
+        sourceSlot[src] = static_cast<int>(sources.size());
+        sources.push_back(src);
+        field.emplace_back();
+        bfsField(src, field.back());
+    }
+
+    // 地图内容的校验和（FNV-1a），存盘后用来确认索引和地图对应
+    uint64_t checksum() const
+    {
+        uint64_t h = 1469598103934665603ULL;
+        for (uint8_t x : g.cell)
+        {
+            h ^= (x == 1);
+            h *= 1099511628211ULL;
+        }
+        return h;
+    }
+
+    int manhattan(int a, int b) const
+    {
+        return std::abs(a / g.cols - b / g.cols) + std::abs(a % g.cols - b % g.cols);
+    }
+
+    // ALT 下界：三角不等式 |d_i(t) - d_i(v)| <= dist(v, t)
+    int lowerBound(int v, int t) const
+    {
+        int h = manhattan(v, t);
+        for (const auto& d : field)
+        {
+            if (d[v] == kUnreachable || d[t] == kUnreachable) continue;
+            int diff = static_cast<int>(d[v] > d[t] ? d[v] - d[t] : d[t] - d[v]);
+            h = std::max(h, diff);
+        }
+        return h;
+    }
+
+   public:
+    explicit MazeIndex(const GridMap& map)
+        : g(map), size(map.rows * map.cols), sourceSlot(size, -1), seen(size, 0), closed(size, 0),
+          dist(size)
+    {
+    }
+
+    /**
+     * @brief 固定目标模式：对每个目标各保存一张距离场
+     */
+    void buildTargets(const std::vector<int>& targets)
+    {
+        for (int t : targets) addSource(t);
+    }
+
+    /**
+     * @brief 地标模式：用最远点策略选 k 个地标
+     *
+     * 第一个地标是离 start 最远的格子，之后每次选“离已有地标最近距离最大”的格子，
+     * 地标会落在迷宫的各个角落，下界更紧。
+     */
+    void buildLandmarks(int k, int start)
+    {
+        if (k <= 0) return;
+        std::vector<uint32_t> d;
+        bfsField(start, d);
+        std::vector<uint32_t> nearest(d);
+        for (int i = 0; i < k; i++)
+        {
+            int best = -1;
+            for (int v = 0; v < size; v++)
+            {
+                if (nearest[v] == kUnreachable || sourceSlot[v] >= 0) continue;
+                if (best == -1 || nearest[v] > nearest[best]) best = v;
+            }
+            if (best == -1) break;
+            addSource(best);
+            const auto& f = field.back();
+            for (int v = 0; v < size; v++) nearest[v] = std::min(nearest[v], f[v]);
+        }
+    }
+
+    int sourceCount() const
+    {
+        return static_cast<int>(sources.size());
+    }
+
+    /**
+     * @brief 查询 s 到 t 的最短步数，不可达返回 -1
+     *
+     * 任一端是源点时直接查表；否则先用距离场判断是否在同一连通块，再做 ALT A*。
+     */
+    int query(int s, int t)
+    {
+        if (s < 0 || s >= size || t < 0 || t >= size || g.cell[s] == 1 || g.cell[t] == 1) return -1;
+        int slot = sourceSlot[t] >= 0 ? sourceSlot[t] : sourceSlot[s];
+        if (slot >= 0)
+        {
+            uint32_t d = field[slot][sourceSlot[t] >= 0 ? s : t];
+            return d == kUnreachable ? -1 : static_cast<int>(d);
+        }
+        for (const auto& d : field)
+        {
+            // 一端能到地标而另一端不能，说明两者不连通
+            if ((d[s] == kUnreachable) != (d[t] == kUnreachable)) return -1;
+        }
+
+        if (++stamp == 0)
+        {
+            std::fill(seen.begin(), seen.end(), 0);
+            std::fill(closed.begin(), closed.end(), 0);
+            stamp = 1;
+        }
+        struct Node
+        {
+            int f, g, idx;
+            bool operator>(const Node& o) const
+            {
+                return f != o.f ? f > o.f : g < o.g;
+            }
+        };
+        std::priority_queue<Node, std::vector<Node>, std::greater<Node>> open;
+        seen[s] = stamp;
+        dist[s] = 0;
+        open.push({lowerBound(s, t), 0, s});
+        while (!open.empty())
+        {
+            Node cur = open.top();
+            open.pop();
+            int u = cur.idx;
+            if (closed[u] == stamp || static_cast<uint32_t>(cur.g) != dist[u]) continue;
+            closed[u] = stamp;
+            if (u == t) return cur.g;
+            int r = u / g.cols, c = u % g.cols;
+            for (int k = 0; k < 4; k++)
+            {
+                if (!g.passable(r + dr[k], c + dc[k])) continue;
+                int v = g.index(r + dr[k], c + dc[k]);
+                uint32_t ng = dist[u] + 1;
+                if (seen[v] == stamp && dist[v] <= ng) continue;
+                seen[v] = stamp;
+                dist[v] = ng;
+                open.push({static_cast<int>(ng) + lowerBound(v, t), static_cast<int>(ng), v});
+            }
+        }
+        return -1;
+    }
+
+    /**
+     * @brief 存盘。格式：魔数、版本、行、列、地图校验和、源点数、源点、各距离场
+     */
+    void save(const std::string& path) const
+    {
+        std::ofstream out(path, std::ios::binary);
+        if (!out) throw std::runtime_error("Cannot open " + path + " for writing");
+        auto put = [&out](const void* p, size_t bytes) {
+            out.write(static_cast<const char*>(p), static_cast<std::streamsize>(bytes));
+        };
+        uint32_t header[4] = {0x58495a4d /* "MZIX" */, 1, static_cast<uint32_t>(g.rows),
+                              static_cast<uint32_t>(g.cols)};
+        uint64_t sum = checksum();
+        uint32_t k = static_cast<uint32_t>(sources.size());
+        put(header, sizeof(header));
+        put(&sum, sizeof(sum));
+        put(&k, sizeof(k));
+        put(sources.data(), sources.size() * sizeof(int));
+        for (const auto& d : field) put(d.data(), d.size() * sizeof(uint32_t));
+        if (!out) throw std::runtime_error("Failed writing " + path);
+    }
+
+    /**
+     * @brief 读入 save() 写出的索引，替换当前的源点和距离场
+     *
+     * 文件截断、损坏或与地图不匹配时抛 runtime_error，当前索引保持不变。
+     */
+    void load(const std::string& path)
+    {
+        std::ifstream in(path, std::ios::binary);
+        if (!in) throw std::runtime_error("Cannot open " + path);
+        auto get = [&in, &path](void* p, size_t bytes) {
+            if (!in.read(static_cast<char*>(p), static_cast<std::streamsize>(bytes)))
+            {
+                throw std::runtime_error("Truncated maze index " + path);
+            }
+        };
+        uint32_t header[4];
+        uint64_t sum;
+        uint32_t k;
+        get(header, sizeof(header));
+        get(&sum, sizeof(sum));
+        get(&k, sizeof(k));
+        if (header[0] != 0x58495a4d || header[1] != 1)
+        {
+            throw std::runtime_error(path + " is not a maze index");
+        }
+        if (header[2] != static_cast<uint32_t>(g.rows) || header[3] != static_cast<uint32_t>(g.cols) ||
+            sum != checksum())
+        {
+            throw std::runtime_error(path + " was built for a different map");
+        }
+        // k 来自文件，先按剩余长度核对，损坏的计数不会触发巨大的分配
+        std::streamoff headerEnd = in.tellg();
+        in.seekg(0, std::ios::end);
+        uint64_t remaining = static_cast<uint64_t>(in.tellg() - headerEnd);
+        in.seekg(headerEnd);
+        uint64_t perSource = sizeof(int) + static_cast<uint64_t>(size) * sizeof(uint32_t);
+        if (k > remaining / perSource) throw std::runtime_error("Truncated maze index " + path);
+
+        // 先读到局部变量并全部校验，成功后再替换成员，出错时对象保持原样
+        std::vector<int> newSources(k);
+        get(newSources.data(), k * sizeof(int));
+        std::vector<int> newSlot(size, -1);
+        for (uint32_t i = 0; i < k; i++)
+        {
+            if (newSources[i] < 0 || newSources[i] >= size || g.cell[newSources[i]] == 1 || newSlot[newSources[i]] >= 0)
+            {
+                throw std::runtime_error("Corrupt maze index " + path);
+            }
+            newSlot[newSources[i]] = static_cast<int>(i);
+        }
+        std::vector<std::vector<uint32_t>> newField(k, std::vector<uint32_t>(size));
+        for (auto& d : newField) get(d.data(), d.size() * sizeof(uint32_t));
+
+        sources.swap(newSources);
+        field.swap(newField);
+        sourceSlot.swap(newSlot);
+    }
+};
+
+#endif  // MAZEINDEX_H
@@ -0,0 +1,179 @@
+// ParallelLabel.h
+#ifndef PARALLELLABEL_H
+#define PARALLELLABEL_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "../Union_Find/ConcurrentDisjointSet.h"
+#include "BitGrid.h"
+
+/**
+ * @file ParallelLabel.h
+ * @brief 分块并行的连通分量标记（四连通）
+ *
+ * 流程：
+ * 1. 把网格切成 tileRows x tileCols 的块，各线程独立给块内做两遍扫描标记，
+ *    得到块内编号 1..k；
+ * 2. 按块的顺序求前缀和，把块内编号改成全局临时编号；
+ * 3. 每个块把自己上边界、左边界与相邻块的前景格子在 ConcurrentDisjointSet 里合并；
+ * 4. 把每个临时编号的根映射成 1..count 的最终编号，再并行改写每个格子。
+ *
+ * 结果：label[r * cols + c]，背景为 0，岛屿编号为 1..count，编号与线程数无关。
+ */
+
+struct ComponentLabels
+{
+    int count = 0;
+    std::vector<uint32_t> label;
+};
+
+// 用 threads 个线程动态领取 [0, tasks) 的任务
+template <typename F>
+void parallelFor(int tasks, int threads, F&& f)
+{
+    std::atomic<int> next(0);
+    auto worker = [&]() {
+        for (int t = next.fetch_add(1); t < tasks; t = next.fetch_add(1)) f(t);
+    };
+    std::vector<std::thread> pool;
+    for (int i = 1; i < threads; i++) pool.emplace_back(worker);
+    worker();
+    for (auto& th : pool) th.join();
+}
+
+inline ComponentLabels labelComponents(const BitGrid& grid, int threads = 0, int tileRows = 256,
+                                       int tileCols = 1024)
+{
+    if (threads <= 0) threads = std::max(1u, std::thread::hardware_concurrency());
+    int rows = grid.rows(), cols = grid.cols();
+    int tilesDown = (rows + tileRows - 1) / tileRows;
+    int tilesAcross = (cols + tileCols - 1) / tileCols;
+    int tiles = tilesDown * tilesAcross;
+
+    ComponentLabels out;
+    out.label.assign(static_cast<size_t>(rows) * cols, 0);
+    uint32_t* lab = out.label.data();
+    std::vector<uint32_t> tileCount(tiles, 0);
+
+    auto tileBounds = [&](int t, int& r0, int& r1, int& c0, int& c1) {
+        r0 = (t / tilesAcross) * tileRows, r1 = std::min(rows, r0 + tileRows);
+        c0 = (t % tilesAcross) * tileCols, c1 = std::min(cols, c0 + tileCols);
+    };
+
+    // 1. 块内两遍扫描：第一遍给临时编号并记录等价关系，第二遍压成 1..k
+    parallelFor(tiles, threads, [&](int t) {
+        int r0, r1, c0, c1;
+        tileBounds(t, r0, r1, c0, c1);
+        std::vector<uint32_t> parent(1, 0);
+        auto find = [&parent](uint32_t x) {
+            while (parent[x] != x) x = parent[x] = parent[parent[x]];
+            return x;
+        };
+        for (int r = r0; r < r1; r++)
+        {
+            for (int c = c0; c < c1; c++)
+            {
+                if (!grid.get(r, c)) continue;
+                size_t i = static_cast<size_t>(r) * cols + c;
+                uint32_t up = r > r0 ? lab[i - cols] : 0;
+                uint32_t left = c > c0 ? lab[i - 1] : 0;
+                if (!up && !left)
+                {
+                    uint32_t id = static_cast<uint32_t>(parent.size());
+                    parent.push_back(id);
+                    lab[i] = id;
+                }
+                else if (up && left)
+                {
+                    uint32_t a = find(up), b = find(left);
+                    if (a != b) parent[std::max(a, b)] = std::min(a, b);
+                    lab[i] = std::min(a, b);
+                }
+                else
+                {
+                    lab[i] = up ? up : left;
+                }
+            }
+        }
+        std::vector<uint32_t> compact(parent.size(), 0);
+        uint32_t k = 0;
+        for (uint32_t x = 1; x < parent.size(); x++)
+        {
+            uint32_t root = find(x);
+            compact[x] = root == x ? ++k : compact[root];
+        }
+        for (int r = r0; r < r1; r++)
+            for (int c = c0; c < c1; c++)
+            {
+                size_t i = static_cast<size_t>(r) * cols + c;
+                if (lab[i]) lab[i] = compact[lab[i]];
+            }
+        tileCount[t] = k;
+    });
+
+    // 2. 块内编号加上前缀和，变成全局临时编号 1..total
+    std::vector<uint32_t> offset(tiles + 1, 0);
+    for (int t = 0; t < tiles; t++) offset[t + 1] = offset[t] + tileCount[t];
+    uint32_t total = offset[tiles];
+    parallelFor(tiles, threads, [&](int t) {
+        int r0, r1, c0, c1;
+        tileBounds(t, r0, r1, c0, c1);
+        for (int r = r0; r < r1; r++)
+            for (int c = c0; c < c1; c++)
+            {
+                size_t i = static_cast<size_t>(r) * cols + c;
+                if (lab[i]) lab[i] += offset[t];
+            }
+    });
+
+    // 3. 沿块的上边界和左边界并发合并
+    ConcurrentDisjointSet dsu(static_cast<int>(total) + 1);
+    parallelFor(tiles, threads, [&](int t) {
+        int r0, r1, c0, c1;
+        tileBounds(t, r0, r1, c0, c1);
+        if (r0 > 0)
+        {
+            for (int c = c0; c < c1; c++)
+            {
+                size_t i = static_cast<size_t>(r0) * cols + c;
+                if (lab[i] && lab[i - cols]) dsu.unite(lab[i], lab[i - cols]);
+            }
+        }
+        if (c0 > 0)
+        {
+            for (int r = r0; r < r1; r++)
+            {
+                size_t i = static_cast<size_t>(r) * cols + c0;
+                if (lab[i] && lab[i - 1]) dsu.unite(lab[i], lab[i - 1]);
+            }
+        }
+    });
+
+    // 4. 根 -> 最终编号，按临时编号从小到大分配，结果与线程调度无关
+    std::vector<uint32_t> finalId(total + 1, 0);
+    uint32_t count = 0;
+    for (uint32_t x = 1; x <= total; x++)
+    {
+        uint32_t root = static_cast<uint32_t>(dsu.find(x));
+        if (!finalId[root]) finalId[root] = ++count;
+        finalId[x] = finalId[root];
+    }
+    parallelFor(tiles, threads, [&](int t) {
+        int r0, r1, c0, c1;
+        tileBounds(t, r0, r1, c0, c1);
+        for (int r = r0; r < r1; r++)
+            for (int c = c0; c < c1; c++)
+            {
+                size_t i = static_cast<size_t>(r) * cols + c;
+                lab[i] = finalId[lab[i]];
+            }
+    });
+    out.count = static_cast<int>(count);
+    return out;
+}
+
+#endif  // PARALLELLABEL_H
@@ -0,0 +1,163 @@
+// StreamIslands.h
+#ifndef STREAMISLANDS_H
+#define STREAMISLANDS_H
+
+#include <cstdint>
+#include <functional>
+#include <istream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../Union_Find/DisjointSet.h"
+#include "BitGrid.h"
+
+/**
+ * @file StreamIslands.h
+ * @brief 逐行读入的岛屿计数，内存只与列数有关
+ *
+ * 只保存“上一行的 1 段及其所属的活跃岛屿”。每读入一行：
+ * - 上一行的每个活跃岛屿和本行的每个 1 段各是一个并查集元素（总数不超过列数）；
+ * - 列区间重叠的段与岛屿合并（同一行的段也会经由上一行的岛屿连在一起）；
+ * - 合并后不含本行任何段的集合再也不会增长，该岛屿结束，计数加一，面积立刻交给回调；
+ * - 其余集合压缩编号，成为下一行的活跃岛屿。
+ * 网格不会被修改，也不需要整体放进内存；已结束的岛屿不保留任何状态，内存 O(列数)。
+ */
+class StreamingIslands
+{
+   private:
+    struct Segment
+    {
+        int begin, end;  // 列区间 [begin, end)
+        int island;      // 所属活跃岛屿的编号
+    };
+
+    std::function<void(long long)> onIsland;  // 岛屿结束时收到它的面积，可以为空
+    long long islands = 0;
+
+    std::vector<Segment> prev, cur;
+    std::vector<long long> activeArea, nextArea;  // 活跃岛屿当前的面积
+    std::vector<long long> closingArea;
+    std::vector<int> newId;
+    std::vector<uint64_t> rowBits;
+    DisjointSet dsu;
+
+    void closeIsland(long long area)
+    {
+        islands++;
+        if (onIsland) onIsland(area);
+    }
+
+   public:
+    // onIsland 非空时，每个岛屿结束就以其面积调用一次（按结束顺序）
+    explicit StreamingIslands(std::function<void(long long)> onIsland = nullptr) : onIsland(std::move(onIsland))
+    {
+    }
+
+    // 送入一行，words 为该行的位数组（格式同 BitGrid::row，超出列数的位必须为 0）
+    void pushRow(const uint64_t* words, int numWords)
+    {
+        int p = static_cast<int>(activeArea.size());
+        cur.clear();
+        forEachRun(words, numWords, [&](int b, int e) { cur.push_back({b, e, 0}); });
+        int c = static_cast<int>(cur.size());
+
+        // 元素 0..p-1 是上一行的活跃岛屿，p..p+c-1 是本行的段
+        dsu.reset(p + c);
+        size_t i = 0, j = 0;
+        while (i < prev.size() && j < cur.size())
+        {
+            if (prev[i].begin < cur[j].end && cur[j].begin < prev[i].end)
+            {
+                dsu.unite(prev[i].island, p + static_cast<int>(j));
+            }
+            if (prev[i].end < cur[j].end) i++;
+            else j++;
+        }
+
+        // 含有本行段的集合继续存活，编号压缩为 0..k-1
+        newId.assign(p + c, -1);
+        nextArea.clear();
+        for (int k = 0; k < c; k++)
+        {
+            int root = dsu.find(p + k);
+            if (newId[root] < 0)
+            {
+                newId[root] = static_cast<int>(nextArea.size());
+                nextArea.push_back(0);
+            }
+            cur[k].island = newId[root];
+            nextArea[newId[root]] += cur[k].end - cur[k].begin;
+        }
+
+        // 上一行的岛屿：并入存活集合就累加面积，否则它在这一行结束；
+        // 结束集合的面积暂存在根的位置上
+        closingArea.assign(p, -1);
+        for (int a = 0; a < p; a++)
+        {
+            int root = dsu.find(a);
+            if (newId[root] >= 0)
+            {
+                nextArea[newId[root]] += activeArea[a];
+            }
+            else
+            {
+                if (closingArea[root] < 0) closingArea[root] = 0;
+                closingArea[root] += activeArea[a];
+            }
+        }
+        for (int a = 0; a < p; a++)
+        {
+            if (closingArea[a] >= 0) closeIsland(closingArea[a]);
+        }
+
+        prev.swap(cur);
+        activeArea.swap(nextArea);
+    }
+
+    // 送入一行字符：每个 '0' / '1' 是一列，其他字符（空格、逗号、引号等）作为分隔符跳过
+    void pushRow(const std::string& line)
+    {
+        rowBits.assign((line.size() + 63) / 64, 0);
+        int cols = 0;
+        for (char ch : line)
+        {
+            if (ch != '0' && ch != '1') continue;
+            rowBits[cols >> 6] |= static_cast<uint64_t>(ch == '1') << (cols & 63);
+            cols++;
+        }
+        pushRow(rowBits.data(), (cols + 63) / 64);
+    }
+
+    // 输入结束：关闭所有仍然活跃的岛屿，返回岛屿总数
+    long long finish()
+    {
+        for (long long area : activeArea) closeIsland(area);
+        activeArea.clear();
+        prev.clear();
+        return islands;
+    }
+
+    long long count() const
+    {
+        return islands;
+    }
+};
+
+/**
+ * @brief 从流中逐行读取网格并统计岛屿数，不含 '0' / '1' 的行被跳过
+ * @param onIsland 非空时，每个岛屿结束就以其面积调用一次（按岛屿结束的顺序）
+ */
+inline long long countIslandsStream(std::istream& in, std::function<void(long long)> onIsland = nullptr)
+{
+    StreamingIslands counter(std::move(onIsland));
+    std::string line;
+    while (std::getline(in, line))
+    {
+        if (line.find_first_of("01") == std::string::npos) continue;
+        counter.pushRow(line);
+    }
+    return counter.finish();
+}
+
+#endif  // STREAMISLANDS_H
@@ -1,47 +1,11 @@
 #include <algorithm>
 #include <cmath>
 #include <iostream>
-#include <queue>
-#include <tuple>
 #include <utility>
 #include <vector>
-using namespace std;
-
-void mark(vector<vector<char>>& n, int i, int j)
-{
-    n[i][j] = '0';
-    return;
-}
-
-void BFS(vector<vector<char>>& grid, int i, int j)
-{
-    int m = grid.size();
-    int n = grid[0].size();
-    vector<tuple<int, int>> directions = {make_tuple(-1, 0), make_tuple(1, 0), make_tuple(0, -1),
-                                          make_tuple(0, 1)};
-
-    queue<tuple<int, int>> q;
-    q.push(make_tuple(i, j));
-    mark(grid, i, j);
-
-    while (!q.empty())
-    {
-        auto [a, b] = q.front();
-        q.pop();
-
-        for (auto [a1, b1] : directions)
-        {
-            int newX = a + a1;
-            int newY = b + b1;
 
-            if (newX >= 0 && newX < m && newY >= 0 && newY < n && grid[newX][newY] == '1')
-            {
-                mark(grid, newX, newY);  // 标记为已访问
-                q.push(make_tuple(newX, newY));
-            }
-        }
-    }
-}
+#include "../Grid/FloodFill.h"
+using namespace std;
 
 class Solution
 {
@@ -58,7 +22,8 @@ class Solution
             {
                 if (grid[i][j] == '1')
                 {
-                    BFS(grid, i, j);
+                    // 扫描线填充，把整座岛标记为 '0'
+                    floodFill(grid, i, j, '1', '0');
 
                     count++;
                 }
@@ -68,17 +33,10 @@ class Solution
     }
 };
 
+// 原来的四路递归 DFS 在几百万格的大岛上会爆栈，改用扫描线填充：
+// 按整段横向填充，显式的段栈代替递归
 void DFS(vector<vector<char>>& grid, int i, int j)
 {
-    int m = grid.size();
-    int n = grid[0].size();
-
-    if (i < 0 || j < 0 || i >= grid.size() || j >= grid[0].size() || grid[i][j] == '0') return;
-
-    mark(grid, i, j);
-
-    DFS(grid, i + 1, j);
-    DFS(grid, i - 1, j);
-    DFS(grid, i, j + 1);
-    DFS(grid, i, j - 1);
-}
\ No newline at end of file
+    if (i < 0 || j < 0 || i >= grid.size() || j >= grid[0].size()) return;
+    floodFill(grid, i, j, '1', '0');
+}
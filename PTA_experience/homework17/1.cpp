@@ -89,6 +89,9 @@ int main()
 #include <algorithm>
 #include <iostream>
 #include <vector>
+
+#include "../../Sort_Methods/KeySort.h"
+#include "../../Union_Find/DisjointSet.h"
 using namespace std;
 
 struct Edge
@@ -96,25 +99,6 @@ struct Edge
     int u, v, w;
 };
 
-vector<int> parent;
-
-int find(int x)
-{
-    if (parent[x] != x)
-    {
-        parent[x] = find(parent[x]);
-    }
-    return parent[x];
-}
-
-bool unite(int x, int y)
-{
-    int rx = find(x), ry = find(y);
-    if (rx == ry) return false;
-    parent[ry] = rx;
-    return true;
-}
-
 int main()
 {
     int n, m;
@@ -126,15 +110,11 @@ int main()
         cin >> edges[i].u >> edges[i].v >> edges[i].w;
     }
 
-    // 按边权排序
-    sort(edges.begin(), edges.end(), [](const Edge& a, const Edge& b) { return a.w < b.w; });
+    // 按边权排序：只排 (边权, 下标) 对，每条边最多搬一次
+    sortByKey(edges, [](const Edge& e) { return e.w; });
 
-    // 初始化并查集
-    parent.resize(n + 1);
-    for (int i = 1; i <= n; i++)
-    {
-        parent[i] = i;
-    }
+    // 初始化并查集，节点编号从1开始
+    DisjointSet dsu(n + 1);
 
     long long total_weight = 0;
     int edges_used = 0;
@@ -142,7 +122,7 @@ int main()
     // Kruskal算法
     for (const auto& e : edges)
     {
-        if (unite(e.u, e.v))
+        if (dsu.unite(e.u, e.v))
         {
             total_weight += e.w;
             edges_used++;
@@ -1,29 +1,8 @@
 #include <iostream>
 #include <vector>
-using namespace std;
-
-vector<int> parent;
-
-// 查找元素x的根节点（路径压缩）
-int find(int x)
-{
-    if (parent[x] != x)
-    {
-        parent[x] = find(parent[x]);  // 路径压缩
-    }
-    return parent[x];
-}
 
-// 合并x和y所在的集合
-void unite(int x, int y)
-{
-    int rootX = find(x);
-    int rootY = find(y);
-    if (rootX != rootY)
-    {
-        parent[rootY] = rootX;
-    }
-}
+#include "../../Union_Find/DisjointSet.h"
+using namespace std;
 
 int main()
 {
@@ -31,11 +10,7 @@ int main()
     cin >> N >> M;
 
     // 初始化并查集，注意节点编号从1开始
-    parent.resize(N + 1);
-    for (int i = 1; i <= N; i++)
-    {
-        parent[i] = i;
-    }
+    DisjointSet dsu(N + 1);
 
     for (int i = 0; i < M; i++)
     {
@@ -45,12 +20,12 @@ int main()
         if (z == 1)
         {
             // 合并操作
-            unite(x, y);
+            dsu.unite(x, y);
         }
         else if (z == 2)
         {
             // 查询操作
-            if (find(x) == find(y))
+            if (dsu.sameSet(x, y))
             {
                 cout << "Y" << endl;
             }
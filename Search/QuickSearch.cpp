@@ -4,6 +4,43 @@
 #include "../Sort_Methods/Quick.h"
 using namespace std;
 
+/**
+ * @brief quickSelect 的主体，选 pivot 和分区的方式与 introSortLoop 相同
+ *
+ * leftmost 为 false 时 a[left-1] 存在且不大于区间内任何元素（它是上一层的pivot）。
+ * 默认用 partition 同款的无分支块分区；只有 pivot 等于 a[left-1]（即 pivot 是区间最小值，
+ * 说明重复值很多）时才改用三路分区，把等于它的一段一次排除。
+ */
+static int quickSelectLoop(vector<int>& a, int left, int right, int k, bool leftmost)
+{
+    // 递归终止条件：只有一个元素
+    if (left == right) {
+        return a[left];
+    }
+
+    auto first = a.begin() + left, last = a.begin() + right + 1;
+    if (right - left >= 2) choosePivot(first, last, less<int>());
+    if (!leftmost && !(a[left - 1] < a[left])) {
+        // 三路分区：[left, hi) 都等于pivot
+        int hi = int(partitionThreeWay(first, last, less<int>()).second - a.begin());
+        if (k < hi) return a[k];
+        return quickSelectLoop(a, hi, right, k, false);
+    }
+
+    // 与 partition 相同：不足三个元素用 Hoare 分区，否则用块分区
+    int p = int((right - left < 2 ? partitionAroundFirst(first, last, less<int>())
+                                  : blockPartitionAroundFirst(first, last, less<int>())) - a.begin());
+
+    // 根据pivot的位置决定下一步
+    if (k == p) {
+        return a[k];  // 找到了第k小的元素
+    } else if (k < p) {
+        return quickSelectLoop(a, left, p - 1, k, leftmost);  // 在左半部分找
+    } else {
+        return quickSelectLoop(a, p + 1, right, k, false);  // 在右半部分找
+    }
+}
+
 /**
  * @brief 快速选择算法 - 查找数组中第k小的元素 (0-based索引)
  * 
@@ -15,22 +52,7 @@ using namespace std;
  */
 int quickSelect(vector<int>& a, int left, int right, int k)
 {
-    // 递归终止条件：只有一个元素
-    if (left == right) {
-        return a[left];
-    }
-    
-    // 分区操作
-    int pivotIndex = partition(a, left, right);
-    
-    // 根据pivot位置决定下一步
-    if (k == pivotIndex) {
-        return a[pivotIndex];  // 找到了第k小的元素
-    } else if (k < pivotIndex) {
-        return quickSelect(a, left, pivotIndex - 1, k);  // 在左半部分找
-    } else {
-        return quickSelect(a, pivotIndex + 1, right, k);  // 在右半部分找
-    }
+    return quickSelectLoop(a, left, right, k, true);
 }
 
 /**
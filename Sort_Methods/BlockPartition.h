@@ -0,0 +1,177 @@
+// BlockPartition.h
+#ifndef BLOCKPARTITION_H
+#define BLOCKPARTITION_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @file BlockPartition.h
+ * @brief BlockQuicksort 风格的无分支分区（Edelkamp & Weiß，实现参照 pdqsort）
+ *
+ * 普通 Hoare 分区里 while (a[i] <= pivot) i++ 这种循环在随机数据上
+ * 大约一半的分支会预测失败。这里改成两步：
+ * 1. 左右各扫描一个块（kPartitionBlockSize 个元素），把“放错边”的元素偏移写进小缓冲区，
+ *    写入位置用比较结果直接累加：offsets[num] = i; num += !comp(x, pivot);  没有条件跳转；
+ * 2. 两个缓冲区里的偏移一一配对，批量交换（用循环移位代替逐对 swap，少一半写入）。
+ *
+ * 前置条件：*first 是枢轴，且 (first, last) 中至少有一个不小于枢轴的元素
+ * （choosePivot 的三数中值保证了这一点）。
+ * 结果与 partitionAroundFirst 相同：返回 p，[first, p) 不大于枢轴，(p, last) 不小于枢轴。
+ */
+
+inline constexpr int kPartitionBlockSize = 64;
+
+// 只有“比较很便宜且没有副作用”时才值得用无分支版本：算术类型 + 标准比较器
+template <typename T, typename Compare>
+struct UseBlockPartition
+    : std::bool_constant<std::is_arithmetic_v<T> &&
+                         (std::is_same_v<Compare, std::less<>> || std::is_same_v<Compare, std::less<T>> ||
+                          std::is_same_v<Compare, std::greater<>> ||
+                          std::is_same_v<Compare, std::greater<T>>)>
+{
+};
+
+// 按偏移交换 num 对元素；数量不同时用循环移位，每个元素只移动一次
+template <typename RandomIt>
+void swapOffsets(RandomIt first, RandomIt last, const unsigned char* offsetsL,
+                 const unsigned char* offsetsR, size_t num, bool useSwaps)
+{
+    if (useSwaps)
+    {
+        // 两边数量相等时循环移位会把元素放错位置，只能逐对交换
+        for (size_t i = 0; i < num; i++) std::iter_swap(first + offsetsL[i], last - offsetsR[i]);
+    }
+    else if (num > 0)
+    {
+        RandomIt l = first + offsetsL[0], r = last - offsetsR[0];
+        auto tmp = std::move(*l);
+        *l = std::move(*r);
+        for (size_t i = 1; i < num; i++)
+        {
+            l = first + offsetsL[i];
+            *r = std::move(*l);
+            r = last - offsetsR[i];
+            *l = std::move(*r);
+        }
+        *r = std::move(tmp);
+    }
+}
+
+template <typename RandomIt, typename Compare>
+RandomIt blockPartitionAroundFirst(RandomIt begin, RandomIt end, Compare comp)
+{
+    auto pivot = std::move(*begin);
+    RandomIt first = begin, last = end;
+
+    // 第一个不小于枢轴的元素（前置条件保证存在）
+    while (comp(*++first, pivot))
+    {
+    }
+    // 从右边找第一个小于枢轴的元素；左边没有越过任何元素时需要边界检查
+    if (first - 1 == begin)
+    {
+        while (first < last && !comp(*--last, pivot))
+        {
+        }
+    }
+    else
+    {
+        while (!comp(*--last, pivot))
+        {
+        }
+    }
+
+    if (first < last)
+    {
+        std::iter_swap(first, last);
+        ++first;
+
+        alignas(64) unsigned char offsetsL[kPartitionBlockSize];
+        alignas(64) unsigned char offsetsR[kPartitionBlockSize];
+        RandomIt baseL = first, baseR = last;
+        size_t numL = 0, numR = 0, startL = 0, startR = 0;
+
+        while (first < last)
+        {
+            // 哪边的缓冲区空了就填哪边；剩余不足两个块时平分
+            size_t unknown = last - first;
+            size_t splitL = numL == 0 ? (numR == 0 ? unknown / 2 : unknown) : 0;
+            size_t splitR = numR == 0 ? (unknown - splitL) : 0;
+
+            if (splitL >= static_cast<size_t>(kPartitionBlockSize))
+            {
+                for (int i = 0; i < kPartitionBlockSize; i++)
+                {
+                    offsetsL[numL] = static_cast<unsigned char>(i);
+                    numL += !comp(*first, pivot);
+                    ++first;
+                }
+            }
+            else
+            {
+                for (size_t i = 0; i < splitL; i++)
+                {
+                    offsetsL[numL] = static_cast<unsigned char>(i);
+                    numL += !comp(*first, pivot);
+                    ++first;
+                }
+            }
+
+            if (splitR >= static_cast<size_t>(kPartitionBlockSize))
+            {
+                for (int i = 0; i < kPartitionBlockSize;)
+                {
+                    offsetsR[numR] = static_cast<unsigned char>(++i);
+                    numR += comp(*--last, pivot);
+                }
+            }
+            else
+            {
+                for (size_t i = 0; i < splitR;)
+                {
+                    offsetsR[numR] = static_cast<unsigned char>(++i);
+                    numR += comp(*--last, pivot);
+                }
+            }
+
+            size_t num = std::min(numL, numR);
+            swapOffsets(baseL, baseR, offsetsL + startL, offsetsR + startR, num, numL == numR);
+            numL -= num, numR -= num;
+            startL += num, startR += num;
+            if (numL == 0)
+            {
+                startL = 0;
+                baseL = first;
+            }
+            if (numR == 0)
+            {
+                startR = 0;
+                baseR = last;
+            }
+        }
+
+        // 只剩一侧的缓冲区还有元素，把它们交换到分界线另一侧
+        if (numL)
+        {
+            while (numL--) std::iter_swap(baseL + offsetsL[startL + numL], --last);
+            first = last;
+        }
+        if (numR)
+        {
+            while (numR--) std::iter_swap(baseR - offsetsR[startR + numR], first), ++first;
+            last = first;
+        }
+    }
+
+    RandomIt pivotPos = first - 1;
+    *begin = std::move(*pivotPos);
+    *pivotPos = std::move(pivot);
+    return pivotPos;
+}
+
+#endif  // BLOCKPARTITION_H
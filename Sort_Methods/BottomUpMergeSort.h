@@ -0,0 +1,142 @@
+// BottomUpMergeSort.h
+#ifndef BOTTOMUPMERGESORT_H
+#define BOTTOMUPMERGESORT_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "IntroSort.h"
+
+/**
+ * @file BottomUpMergeSort.h
+ * @brief 自底向上的归并排序：整个排序只分配一次辅助缓冲区
+ *
+ * - 先把数组切成 kMergeBaseBlock 长的基块，各自插入排序（int 升序时用排序网络）；
+ * - 然后每趟把相邻两段合并，源和目标在“原数组 / 缓冲区”之间来回切换（乒乓），
+ *   不需要每次合并后再拷回；
+ * - 总趟数为奇数时，基块直接插入排序到缓冲区里，保证最后一趟正好落回原数组；
+ * - 相邻两段已经有序（左段末尾不大于右段开头）时跳过合并，直接搬运。
+ *
+ * 稳定：相等元素总是先取左段的。
+ */
+
+// 基块长度，基块内部用插入排序
+inline constexpr int kMergeBaseBlock = 32;
+
+/**
+ * @brief 稳定合并 [first1, last1) 和 [first2, last2) 到 out，返回写入末尾
+ */
+template <typename InIt1, typename InIt2, typename OutIt, typename Compare>
+OutIt mergeRuns(InIt1 first1, InIt1 last1, InIt2 first2, InIt2 last2, OutIt out, Compare comp)
+{
+    if (first1 != last1 && first2 != last2)
+    {
+        while (true)
+        {
+            if (comp(*first2, *first1))
+            {
+                *out++ = std::move(*first2++);
+                if (first2 == last2) break;
+            }
+            else
+            {
+                *out++ = std::move(*first1++);
+                if (first1 == last1) break;
+            }
+        }
+    }
+    out = std::move(first1, last1, out);
+    return std::move(first2, last2, out);
+}
+
+/**
+ * @brief 把 [first, last) 插入排序后写到 out 开始的位置（稳定），两段不能重叠
+ */
+template <typename InIt, typename OutIt, typename Compare>
+void insertionSortMove(InIt first, InIt last, OutIt out, Compare comp)
+{
+    if (first == last) return;
+    OutIt end = out;
+    *end++ = std::move(*first);
+    for (InIt it = first + 1; it != last; ++it, ++end)
+    {
+        OutIt j = end;
+        for (; j != out && comp(*it, *(j - 1)); --j) *j = std::move(*(j - 1));
+        *j = std::move(*it);
+    }
+}
+
+/**
+ * @brief 一趟合并：src 中每两段长为 width 的有序段合并到 dst 的相同位置
+ */
+template <typename SrcIt, typename DstIt, typename Compare>
+void mergePass(SrcIt src, DstIt dst, std::ptrdiff_t n, std::ptrdiff_t width, Compare comp)
+{
+    for (std::ptrdiff_t lo = 0; lo < n; lo += 2 * width)
+    {
+        std::ptrdiff_t mid = std::min(lo + width, n), hi = std::min(lo + 2 * width, n);
+        if (mid == hi || !comp(src[mid], src[mid - 1]))
+            std::move(src + lo, src + hi, dst + lo);  // 只有一段，或两段已经首尾有序
+        else
+            mergeRuns(src + lo, src + mid, src + mid, src + hi, dst + lo, comp);
+    }
+}
+
+/**
+ * @brief 用调用方提供的缓冲区（至少 last - first 个元素）排序 [first, last)，不分配内存
+ */
+template <typename RandomIt, typename BufferIt, typename Compare>
+void bottomUpMergeSort(RandomIt first, RandomIt last, BufferIt buffer, Compare comp)
+{
+    std::ptrdiff_t n = last - first;
+    if (n < 2) return;
+
+    int passes = 0;
+    for (std::ptrdiff_t width = kMergeBaseBlock; width < n; width *= 2) passes++;
+
+    // 奇数趟：基块先排到缓冲区，这样最后一趟的目标是原数组
+    bool inBuffer = passes % 2 == 1;
+    for (std::ptrdiff_t lo = 0; lo < n; lo += kMergeBaseBlock)
+    {
+        std::ptrdiff_t hi = std::min<std::ptrdiff_t>(lo + kMergeBaseBlock, n);
+        if constexpr (UseSortingNetwork<RandomIt, Compare>::value && std::contiguous_iterator<BufferIt>)
+        {
+            // int 升序：相等元素无法区分，排序网络不影响稳定性
+            if (inBuffer) std::copy(first + lo, first + hi, buffer + lo);
+            sortNetwork(std::to_address(inBuffer ? buffer + lo : first + lo), static_cast<int>(hi - lo));
+        }
+        else if (inBuffer)
+        {
+            insertionSortMove(first + lo, first + hi, buffer + lo, comp);
+        }
+        else
+        {
+            insertionSort(first + lo, first + hi, comp);
+        }
+    }
+
+    for (std::ptrdiff_t width = kMergeBaseBlock; width < n; width *= 2)
+    {
+        if (inBuffer) mergePass(buffer, first, n, width, comp);
+        else mergePass(first, buffer, n, width, comp);
+        inBuffer = !inBuffer;
+    }
+}
+
+/**
+ * @brief 对 [first, last) 稳定排序，O(n log n)，只分配一次 n 个元素的缓冲区
+ */
+template <typename RandomIt, typename Compare = std::less<>>
+void bottomUpMergeSort(RandomIt first, RandomIt last, Compare comp = Compare())
+{
+    using T = typename std::iterator_traits<RandomIt>::value_type;
+    if (last - first < 2) return;
+    std::vector<T> buffer(last - first);
+    bottomUpMergeSort(first, last, buffer.begin(), comp);
+}
+
+#endif  // BOTTOMUPMERGESORT_H
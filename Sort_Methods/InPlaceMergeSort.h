@@ -0,0 +1,197 @@
+// InPlaceMergeSort.h
+#ifndef INPLACEMERGESORT_H
+#define INPLACEMERGESORT_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "BottomUpMergeSort.h"
+
+/**
+ * @file InPlaceMergeSort.h
+ * @brief 只用 O(√n) 辅助空间的稳定归并排序（分块归并，思路同 GrailSort / WikiSort 的外部缓冲版本）
+ *
+ * 仍然是自底向上归并，只是缓冲区只有 s ≈ √n 个元素：
+ * - 两段中较短的一段放得进缓冲区时，和普通归并一样，把它拷进缓冲区再合并；
+ * - 否则分块合并 A = [lo, mid) 和 B = [mid, hi)：
+ *   1. A 开头不满 s 的零头 A0、B 末尾不满 s 的零头 Bt 单独处理，中间都是长为 s 的整块；
+ *   2. 按块的首元素把 A 块、B 块排成一列（首元素相等时 A 块在前）。A 块之间、B 块之间本来就按首元素有序，
+ *      所以只需归并两列块号，再沿置换环逐块搬运，每块只动一次，缓冲区暂存一块；
+ *   3. 从左到右扫描：上一段剩下的“待定”部分和下一块来源不同时，把待定部分拷进缓冲区与该块合并，
+ *      直到其中一边用完，剩下的成为新的待定部分；来源相同时待定部分已经就位；
+ *   4. 最后把 Bt 和前面已有序的部分合并（Bt 放得进缓冲区）。
+ *   每层归并的搬运和比较都是 O(n)，总共 O(n log n)。
+ *
+ * 缓冲区 s 个元素，另有 O(n / s) 个块号，合计 O(√n)。稳定：相等元素总是 A 段的在前。
+ */
+
+namespace inplace_merge_detail
+{
+
+// [first, mid) 拷进缓冲区，与 [mid, last) 从前往后合并，相等时取左段
+template <typename RandomIt, typename BufferIt, typename Compare>
+void mergeWithLeftBuffered(RandomIt first, RandomIt mid, RandomIt last, BufferIt buffer, Compare comp)
+{
+    BufferIt bLast = std::move(first, mid, buffer);
+    mergeRuns(buffer, bLast, mid, last, first, comp);
+}
+
+// [mid, last) 拷进缓冲区，与 [first, mid) 从后往前合并，相等时取左段
+template <typename RandomIt, typename BufferIt, typename Compare>
+void mergeWithRightBuffered(RandomIt first, RandomIt mid, RandomIt last, BufferIt buffer, Compare comp)
+{
+    BufferIt b = buffer, bLast = std::move(mid, last, buffer);
+    RandomIt l = mid, out = last;
+    if (l != first && b != bLast)
+    {
+        while (true)
+        {
+            if (comp(*(bLast - 1), *(l - 1)))
+            {
+                *--out = std::move(*--l);
+                if (l == first) break;
+            }
+            else
+            {
+                *--out = std::move(*--bLast);
+                if (b == bLast) break;
+            }
+        }
+    }
+    std::move_backward(b, bLast, out);
+}
+
+/**
+ * @brief 合并相邻有序段 [first, mid) 和 [mid, last)，缓冲区 buffer 至少 s 个元素
+ *
+ * order、fromA 存放块号和块的来源，调用方复用同一组数组，避免每次合并都分配。
+ */
+template <typename RandomIt, typename BufferIt, typename Compare>
+void blockMerge(RandomIt first, RandomIt mid, RandomIt last, BufferIt buffer, std::ptrdiff_t s,
+                std::vector<std::ptrdiff_t>& order, std::vector<char>& fromA, Compare comp)
+{
+    // 左段开头不大于 *mid 的部分、右段末尾不小于 *(mid - 1) 的部分已经在位
+    first = std::upper_bound(first, mid, *mid, comp);
+    if (first == mid) return;
+    last = std::lower_bound(mid, last, *(mid - 1), comp);
+    if (mid == last) return;
+    if (mid - first <= s)
+    {
+        mergeWithLeftBuffered(first, mid, last, buffer, comp);
+        return;
+    }
+    if (last - mid <= s)
+    {
+        mergeWithRightBuffered(first, mid, last, buffer, comp);
+        return;
+    }
+
+    // 1. 切块：[first, blocks) 是 A0，[blocks, tail) 是整块，[tail, last) 是 Bt
+    std::ptrdiff_t a0 = (mid - first) % s;
+    RandomIt blocks = first + a0, tail = last - (last - mid) % s;
+    std::ptrdiff_t aCount = (mid - blocks) / s, count = (tail - blocks) / s;
+    auto block = [&](std::ptrdiff_t i) { return blocks + i * s; };
+
+    // 2. 按首元素归并两列块号，再沿置换环搬运；order[i] 是新位置 i 上的原块号
+    order.resize(count);
+    {
+        std::ptrdiff_t i = 0, j = aCount, k = 0;
+        while (i < aCount && j < count) order[k++] = comp(*block(j), *block(i)) ? j++ : i++;
+        while (i < aCount) order[k++] = i++;
+        while (j < count) order[k++] = j++;
+    }
+    fromA.resize(count);
+    for (std::ptrdiff_t i = 0; i < count; i++) fromA[i] = order[i] < aCount;
+    for (std::ptrdiff_t start = 0; start < count; start++)
+    {
+        if (order[start] == start || order[start] < 0) continue;
+        std::move(block(start), block(start) + s, buffer);
+        std::ptrdiff_t j = start;
+        while (true)
+        {
+            std::ptrdiff_t src = order[j];
+            order[j] = -1;  // 已就位
+            if (src == start)
+            {
+                std::move(buffer, buffer + s, block(j));
+                break;
+            }
+            std::move(block(src), block(src) + s, block(j));
+            j = src;
+        }
+    }
+
+    // 3. 逐块合并：待定部分 [pending, block(i)) 来自 pendingFromA 一侧
+    RandomIt pending = first;
+    bool pendingFromA = true;
+    for (std::ptrdiff_t i = 0; i < count; i++)
+    {
+        RandomIt b = block(i), bLast = b + s;
+        if (pending == b || fromA[i] == pendingFromA)
+        {
+            pending = b;
+            pendingFromA = fromA[i];
+            continue;
+        }
+        // 相等时 A 一侧的元素在前
+        BufferIt p = buffer, pLast = std::move(pending, b, buffer);
+        RandomIt out = pending;
+        while (p != pLast && b != bLast)
+        {
+            bool takeBlock = pendingFromA ? comp(*b, *p) : !comp(*p, *b);
+            if (takeBlock) *out++ = std::move(*b++);
+            else *out++ = std::move(*p++);
+        }
+        if (p == pLast)
+        {
+            pending = b;  // 待定部分用完，块里剩下的成为新的待定部分
+            pendingFromA = fromA[i];
+        }
+        else
+        {
+            std::move(p, pLast, out);  // 块用完，待定部分仍来自原来一侧
+            pending = out;
+        }
+    }
+
+    // 4. 合并 B 的零头
+    if (tail != last) mergeWithRightBuffered(std::upper_bound(first, tail, *tail, comp), tail, last, buffer, comp);
+}
+
+}  // namespace inplace_merge_detail
+
+/**
+ * @brief 对 [first, last) 稳定排序，辅助空间 O(√n)
+ */
+template <typename RandomIt, typename Compare = std::less<>>
+void inPlaceMergeSort(RandomIt first, RandomIt last, Compare comp = Compare())
+{
+    using namespace inplace_merge_detail;
+    using T = typename std::iterator_traits<RandomIt>::value_type;
+    std::ptrdiff_t n = last - first;
+    if (n < 2) return;
+
+    for (std::ptrdiff_t lo = 0; lo < n; lo += kMergeBaseBlock)
+        smallSort(first + lo, first + std::min<std::ptrdiff_t>(lo + kMergeBaseBlock, n), comp);
+    if (n <= kMergeBaseBlock) return;
+
+    std::ptrdiff_t s = std::max<std::ptrdiff_t>(kMergeBaseBlock, static_cast<std::ptrdiff_t>(std::sqrt(double(n))));
+    std::vector<T> buffer(s);
+    std::vector<std::ptrdiff_t> order;
+    std::vector<char> fromA;
+    for (std::ptrdiff_t width = kMergeBaseBlock; width < n; width *= 2)
+    {
+        for (std::ptrdiff_t lo = 0; lo + width < n; lo += 2 * width)
+        {
+            RandomIt mid = first + lo + width, hi = first + std::min(lo + 2 * width, n);
+            if (comp(*mid, *(mid - 1))) blockMerge(first + lo, mid, hi, buffer.begin(), s, order, fromA, comp);
+        }
+    }
+}
+
+#endif  // INPLACEMERGESORT_H
@@ -0,0 +1,260 @@
+// IntroSort.h
+#ifndef INTROSORT_H
+#define INTROSORT_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+
+#include "BlockPartition.h"
+#include "SortingNetwork.h"
+
+/**
+ * @file IntroSort.h
+ * @brief 内省排序（introsort）：快速排序 + 插入排序 + 堆排序兜底
+ *
+ * - 主枢轴取三数中值，区间较大时取 Tukey ninther（九数中值），有序、逆序输入不会退化；
+ * - 区间长度不超过 kInsertionSortCutoff 时改用插入排序；int 升序排序时区间不超过
+ *   kSortNetworkCutoff 就交给 SortingNetwork.h 的 AVX2 排序网络；
+ * - 递归深度超过 2*log2(n) 时改用堆排序，保证最坏 O(n log n)；
+ * - 只递归较小的一侧，较大的一侧在循环里继续处理，栈深度 O(log n)；
+ * - 算术类型配标准比较器时用 BlockPartition.h 的无分支分区；
+ * - 枢轴等于区间左边界外的元素时（说明它是区间最小值且有重复），改用三路分区，
+ *   整段等于枢轴的元素一次排好、不再递归，只有少数几种取值的输入也是 O(n log k)。
+ *
+ * 对任意随机访问迭代器和严格弱序比较器都适用。
+ */
+
+// 小于等于这个长度的区间直接插入排序
+inline constexpr int kInsertionSortCutoff = 16;
+// 能用排序网络时，小于等于这个长度的区间直接交给排序网络
+inline constexpr int kSortNetworkCutoff = 32;
+// 大于这个长度的区间用 ninther 选枢轴
+inline constexpr int kNintherThreshold = 128;
+
+template <typename RandomIt, typename Compare>
+void insertionSort(RandomIt first, RandomIt last, Compare comp)
+{
+    if (first == last) return;
+    for (RandomIt i = first + 1; i != last; ++i)
+    {
+        auto x = std::move(*i);
+        RandomIt j = i;
+        for (; j != first && comp(x, *(j - 1)); --j) *j = std::move(*(j - 1));
+        *j = std::move(x);
+    }
+}
+
+// 小区间的基本情况：能用排序网络就用，否则插入排序
+template <typename RandomIt, typename Compare>
+void smallSort(RandomIt first, RandomIt last, Compare comp)
+{
+    if constexpr (UseSortingNetwork<RandomIt, Compare>::value)
+    {
+        sortNetwork(std::to_address(first), static_cast<int>(last - first));
+    }
+    else
+    {
+        insertionSort(first, last, comp);
+    }
+}
+
+template <typename RandomIt, typename Compare>
+void siftDown(RandomIt first, std::ptrdiff_t i, std::ptrdiff_t n, Compare comp)
+{
+    auto x = std::move(first[i]);
+    while (true)
+    {
+        std::ptrdiff_t child = 2 * i + 1;
+        if (child >= n) break;
+        if (child + 1 < n && comp(first[child], first[child + 1])) child++;
+        if (!comp(x, first[child])) break;
+        first[i] = std::move(first[child]);
+        i = child;
+    }
+    first[i] = std::move(x);
+}
+
+template <typename RandomIt, typename Compare>
+void heapSort(RandomIt first, RandomIt last, Compare comp)
+{
+    std::ptrdiff_t n = last - first;
+    for (std::ptrdiff_t i = n / 2 - 1; i >= 0; i--) siftDown(first, i, n, comp);
+    for (std::ptrdiff_t end = n - 1; end > 0; end--)
+    {
+        std::iter_swap(first, first + end);
+        siftDown(first, 0, end, comp);
+    }
+}
+
+// 把 *a, *b, *c 排成 *a <= *b <= *c
+template <typename RandomIt, typename Compare>
+void sort3(RandomIt a, RandomIt b, RandomIt c, Compare comp)
+{
+    if (comp(*b, *a)) std::iter_swap(a, b);
+    if (comp(*c, *b))
+    {
+        std::iter_swap(b, c);
+        if (comp(*b, *a)) std::iter_swap(a, b);
+    }
+}
+
+/**
+ * @brief 选枢轴并把它放到 *first
+ *
+ * 三数中值排好后，首尾两端分别是不大于/不小于枢轴的元素，
+ * 对有序和逆序输入都能选到真正的中间值。
+ */
+template <typename RandomIt, typename Compare>
+void choosePivot(RandomIt first, RandomIt last, Compare comp)
+{
+    std::ptrdiff_t n = last - first;
+    RandomIt mid = first + n / 2;
+    if (n > kNintherThreshold)
+    {
+        std::ptrdiff_t s = n / 8;
+        sort3(first, first + s, first + 2 * s, comp);
+        sort3(mid - s, mid, mid + s, comp);
+        sort3(last - 1 - 2 * s, last - 1 - s, last - 1, comp);
+        sort3(first + s, mid, last - 1 - s, comp);
+    }
+    else
+    {
+        sort3(first, mid, last - 1, comp);
+    }
+    std::iter_swap(first, mid);
+}
+
+/**
+ * @brief 以 *first 为枢轴做 Hoare 分区，返回枢轴的最终位置 p
+ *
+ * 结束后 [first, p) 中的元素不大于枢轴，(p, last) 中的元素不小于枢轴。
+ * 与枢轴相等的元素两边都会停下交换，大量重复值时两侧仍然均衡。
+ */
+template <typename RandomIt, typename Compare>
+RandomIt partitionAroundFirst(RandomIt first, RandomIt last, Compare comp)
+{
+    RandomIt i = first + 1, j = last - 1;
+    while (true)
+    {
+        while (i <= j && comp(*i, *first)) ++i;
+        while (i <= j && comp(*first, *j)) --j;
+        if (i >= j) break;
+        std::iter_swap(i, j);
+        ++i;
+        --j;
+    }
+    std::iter_swap(first, j);
+    return j;
+}
+
+/**
+ * @brief 排序用的分区入口：能用无分支分区时就用，否则退回 Hoare 分区
+ *
+ * 调用前 choosePivot 已经把枢轴放在 *first，且区间长度不小于 3。
+ */
+template <typename RandomIt, typename Compare>
+RandomIt partitionForSort(RandomIt first, RandomIt last, Compare comp)
+{
+    using T = typename std::iterator_traits<RandomIt>::value_type;
+    if constexpr (UseBlockPartition<T, Compare>::value)
+    {
+        return blockPartitionAroundFirst(first, last, comp);
+    }
+    else
+    {
+        return partitionAroundFirst(first, last, comp);
+    }
+}
+
+/**
+ * @brief 以 *first 为枢轴做三路分区（Bentley–McIlroy），返回等于枢轴的一段 [lo, hi)
+ *
+ * 结束后 [first, lo) 小于枢轴，[lo, hi) 等于枢轴，[hi, last) 大于枢轴。
+ * 扫描时把等于枢轴的元素先交换到两端，最后再换回中间，
+ * 没有重复元素时额外开销只是每次比较后多一次相等判断。
+ */
+template <typename RandomIt, typename Compare>
+std::pair<RandomIt, RandomIt> partitionThreeWay(RandomIt first, RandomIt last, Compare comp)
+{
+    // [first, a) 等于，[a, b) 小于，[b, c] 未处理，(c, d] 大于，(d, last) 等于
+    RandomIt a = first + 1, b = first + 1, c = last - 1, d = last - 1;
+    while (true)
+    {
+        for (; b <= c && !comp(*first, *b); ++b)
+        {
+            if (!comp(*b, *first)) std::iter_swap(a++, b);
+        }
+        for (; b <= c && !comp(*c, *first); --c)
+        {
+            if (!comp(*first, *c)) std::iter_swap(c, d--);
+        }
+        if (b > c) break;
+        std::iter_swap(b++, c--);
+    }
+    // 两端等于枢轴的元素换回中间
+    std::ptrdiff_t s = std::min(a - first, b - a);
+    std::swap_ranges(first, first + s, b - s);
+    s = std::min((last - 1) - d, d - c);
+    std::swap_ranges(b, b + s, last - s);
+    return {first + (b - a), last - (d - c)};
+}
+
+/**
+ * @brief introsort 主循环
+ *
+ * leftmost 为 false 时 *(first - 1) 存在且不大于区间内任何元素（它是上一层的枢轴或左侧元素）。
+ */
+template <typename RandomIt, typename Compare>
+void introSortLoop(RandomIt first, RandomIt last, int depthLimit, Compare comp, bool leftmost = true)
+{
+    constexpr std::ptrdiff_t cutoff =
+        UseSortingNetwork<RandomIt, Compare>::value ? kSortNetworkCutoff : kInsertionSortCutoff;
+    while (last - first > cutoff)
+    {
+        if (depthLimit == 0)
+        {
+            heapSort(first, last, comp);
+            return;
+        }
+        depthLimit--;
+        choosePivot(first, last, comp);
+        if (!leftmost && !comp(*(first - 1), *first))
+        {
+            // 枢轴等于区间最小值：等于它的一段直接就位，只剩右侧大于枢轴的部分
+            first = partitionThreeWay(first, last, comp).second;
+            continue;
+        }
+        RandomIt p = partitionForSort(first, last, comp);
+        // 递归较小的一侧，较大的一侧留在循环里（尾递归消除）
+        if (p - first < last - p)
+        {
+            introSortLoop(first, p, depthLimit, comp, leftmost);
+            first = p + 1;
+            leftmost = false;
+        }
+        else
+        {
+            introSortLoop(p + 1, last, depthLimit, comp, false);
+            last = p;
+        }
+    }
+    smallSort(first, last, comp);
+}
+
+/**
+ * @brief 对 [first, last) 排序，最坏 O(n log n)，不稳定
+ */
+template <typename RandomIt, typename Compare = std::less<>>
+void introSort(RandomIt first, RandomIt last, Compare comp = Compare())
+{
+    std::ptrdiff_t n = last - first;
+    if (n < 2) return;
+    int depthLimit = 0;
+    for (std::ptrdiff_t k = n; k > 1; k >>= 1) depthLimit += 2;
+    introSortLoop(first, last, depthLimit, comp);
+}
+
+#endif  // INTROSORT_H
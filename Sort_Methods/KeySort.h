@@ -0,0 +1,157 @@
+// KeySort.h
+#ifndef KEYSORT_H
+#define KEYSORT_H
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "BottomUpMergeSort.h"
+#include "RadixSort.h"
+
+/**
+ * @file KeySort.h
+ * @brief 按键排序记录：只排 (键, 下标) 对，记录本身最多移动一次
+ *
+ * 直接 sort(records, [](a, b) { return a.w < b.w; }) 时，每次交换都要搬整条记录，
+ * 记录越宽越慢。这里分三步：
+ * 1. 把每条记录的键抽出来，和下标一起放进紧凑数组；
+ * 2. 对 (键, 下标) 对排序：整数键（bool 除外）和 float、double 键映射成无符号整数后用 LSD 基数排序，
+ *    其他可比较的键（bool、long double、字符串等）用 bottomUpMergeSort；
+ * 3. 得到排列后，要么按排列把记录各搬一次（sortByKey），要么直接返回排列（sortPermutation），
+ *    调用方按排列访问，记录完全不动。
+ *
+ * 记录本身很窄（不超过 kKeySortDirectBytes 字节，且可平凡复制）并且键是数值时，
+ * 间接排序反而多一次随机访问，sortByKey 直接对记录做基数排序。
+ *
+ * 稳定：键相等的记录保持原有相对顺序。记录数不能超过 2^32 - 1。
+ */
+
+// 不超过这个宽度的记录直接基数排序，不走 (键, 下标)
+inline constexpr std::size_t kKeySortDirectBytes = 16;
+
+// 能映射成无符号整数做基数排序的键：bool 以外的整数、float、double。
+// long double 的位模式里有填充字节且各平台格式不同，不能 bit_cast
+template <typename Key>
+struct IsRadixKey : std::bool_constant<(std::is_integral_v<Key> && !std::is_same_v<Key, bool>) ||
+                                       std::is_same_v<Key, float> || std::is_same_v<Key, double>>
+{
+};
+
+/**
+ * @brief 把浮点数映射为保序的无符号整数：正数翻转符号位，负数按位取反
+ *
+ * -0.0 会排在 +0.0 之前；NaN 按位模式排在两端。
+ */
+template <typename F>
+auto floatKey(F x)
+{
+    static_assert(std::is_same_v<F, float> || std::is_same_v<F, double>, "floatKey 只支持 float、double");
+    using U = std::conditional_t<sizeof(F) == 4, std::uint32_t, std::uint64_t>;
+    U u = std::bit_cast<U>(x);
+    constexpr U kSign = U(1) << (std::numeric_limits<U>::digits - 1);
+    return (u & kSign) ? ~u : (u | kSign);
+}
+
+// 数值键映射为保序的无符号整数
+template <typename Key>
+auto keyBits(Key k)
+{
+    static_assert(IsRadixKey<Key>::value, "keyBits 只支持 bool 以外的整数和 float、double");
+    if constexpr (std::is_floating_point_v<Key>) return floatKey(k);
+    else return radixKey(k);
+}
+
+/**
+ * @brief 返回按 keyOf(record) 升序排列后的下标序列，记录不动
+ *
+ * 结果 perm 满足 records[perm[0]], records[perm[1]], ... 按键升序，键相等时下标小的在前。
+ */
+template <typename Record, typename KeyOf>
+std::vector<std::uint32_t> sortPermutation(const std::vector<Record>& records, KeyOf keyOf)
+{
+    using Key = std::decay_t<decltype(keyOf(records[0]))>;
+    if (records.size() > std::numeric_limits<std::uint32_t>::max())
+        throw std::length_error("sortPermutation: 记录数超过 2^32 - 1");
+    std::uint32_t n = static_cast<std::uint32_t>(records.size());
+    std::vector<std::uint32_t> perm(n);
+
+    if constexpr (IsRadixKey<Key>::value)
+    {
+        // 整数、浮点键：转成无符号整数后基数排序
+        using U = decltype(keyBits(Key()));
+        struct KeyIndex
+        {
+            U key;
+            std::uint32_t index;
+        };
+        auto pairs = std::make_unique_for_overwrite<KeyIndex[]>(n);
+        auto buffer = std::make_unique_for_overwrite<KeyIndex[]>(n);
+        for (std::uint32_t i = 0; i < n; i++) pairs[i] = {keyBits(keyOf(records[i])), i};
+        radixSortBy(pairs.get(), buffer.get(), n, [](const KeyIndex& p) { return p.key; });
+        for (std::uint32_t i = 0; i < n; i++) perm[i] = pairs[i].index;
+    }
+    else
+    {
+        // 其他键（例如 bool、long double、字符串）：稳定归并排序 (键, 下标) 对
+        std::vector<std::pair<Key, std::uint32_t>> pairs;
+        pairs.reserve(n);
+        for (std::uint32_t i = 0; i < n; i++) pairs.emplace_back(keyOf(records[i]), i);
+        bottomUpMergeSort(pairs.begin(), pairs.end(),
+                          [](const auto& a, const auto& b) { return a.first < b.first; });
+        for (std::uint32_t i = 0; i < n; i++) perm[i] = pairs[i].second;
+    }
+    return perm;
+}
+
+/**
+ * @brief 按排列重排记录：结束后 records[i] 是原来的 records[perm[i]]
+ *
+ * 每条记录只移动一次：按排列顺序写到新数组（顺序写、预取随机读），再整体换回。
+ * 需要 n 条记录的额外空间；比沿置换环就地搬运快得多，后者每一步都是一次缓存缺失。
+ */
+template <typename Record>
+void applyPermutation(std::vector<Record>& records, const std::vector<std::uint32_t>& perm)
+{
+    constexpr std::size_t kPrefetchDistance = 16;
+    std::size_t n = records.size();
+    std::vector<Record> sorted;
+    sorted.reserve(n);
+    for (std::size_t i = 0; i < n; i++)
+    {
+#if defined(__GNUC__)
+        if (i + kPrefetchDistance < n) __builtin_prefetch(&records[perm[i + kPrefetchDistance]]);
+#endif
+        sorted.push_back(std::move(records[perm[i]]));
+    }
+    records.swap(sorted);
+}
+
+/**
+ * @brief 按 keyOf(record) 稳定排序 records
+ */
+template <typename Record, typename KeyOf>
+void sortByKey(std::vector<Record>& records, KeyOf keyOf)
+{
+    using Key = std::decay_t<decltype(keyOf(records[0]))>;
+    if (records.size() < 2) return;
+    if constexpr (IsRadixKey<Key>::value && std::is_trivially_copyable_v<Record> &&
+                  std::is_default_constructible_v<Record> && sizeof(Record) <= kKeySortDirectBytes)
+    {
+        auto buffer = std::make_unique_for_overwrite<Record[]>(records.size());
+        radixSortBy(records.data(), buffer.get(), records.size(),
+                    [&keyOf](const Record& r) { return keyBits(keyOf(r)); });
+    }
+    else
+    {
+        applyPermutation(records, sortPermutation(records, keyOf));
+    }
+}
+
+#endif  // KEYSORT_H
@@ -0,0 +1,54 @@
+// Merge.h
+#ifndef MERGE_H
+#define MERGE_H
+
+#include <vector>
+
+#include "BottomUpMergeSort.h"
+#include "InPlaceMergeSort.h"
+
+/**
+ * @file Merge.h
+ * @brief 归并排序算法实现
+ *
+ * 提供归并排序的合并和排序函数
+ */
+
+// Mergesort 的辅助空间：Buffered 用 n 个元素的缓冲区，最快；InPlace 只用 O(√n)，内存紧张时用
+enum class MergeSortMemory
+{
+    Buffered,
+    InPlace
+};
+
+/**
+ * @brief 合并函数
+ *
+ * 把 src 中两个相邻的有序段 [left, mid] 和 [mid+1, right] 稳定地合并，
+ * 结果写到 dst 的同一位置 [left, right]。src 和 dst 不能是同一个数组，
+ * 自底向上排序时两者轮流充当源和目标，合并完不需要拷回。
+ *
+ * @param src 源数组
+ * @param dst 目标数组，大小不小于 right + 1
+ * @param left 左段起点（包含）
+ * @param mid 左段终点（包含）
+ * @param right 右段终点（包含）
+ */
+void merge(const std::vector<int>& src, std::vector<int>& dst, int left, int mid, int right);
+
+/**
+ * @brief 归并排序主函数
+ *
+ * 对数组a中[left, right]范围内的元素进行稳定排序。
+ * 实现为自底向上归并（见 BottomUpMergeSort.h）：整个排序只分配一次缓冲区，
+ * 基块插入排序，已经有序的相邻段跳过合并。
+ * memory 为 InPlace 时改用分块归并（见 InPlaceMergeSort.h），辅助空间 O(√n)，同样稳定。
+ *
+ * @param a 待排序的数组引用
+ * @param left 排序左边界（包含）
+ * @param right 排序右边界（包含）
+ * @param memory 辅助空间模式，默认 Buffered
+ */
+void Mergesort(std::vector<int>& a, int left, int right, MergeSortMemory memory = MergeSortMemory::Buffered);
+
+#endif  // MERGE_H
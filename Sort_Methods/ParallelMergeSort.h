@@ -0,0 +1,158 @@
+// ParallelMergeSort.h
+#ifndef PARALLELMERGESORT_H
+#define PARALLELMERGESORT_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "BottomUpMergeSort.h"
+#include "WorkStealingPool.h"
+
+/**
+ * @file ParallelMergeSort.h
+ * @brief 并行稳定归并排序，合并也按 merge path 切块并行
+ *
+ * 1. 把数组切成与线程数相同的块，各块并行做 bottomUpMergeSort；
+ * 2. 之后每趟把相邻两段合并（原数组与缓冲区乒乓），每次合并的输出再切成
+ *    长度约为 pieceLen 的小段：输出位置 d 对应两段中各取多少个元素，
+ *    可以在 merge path 的对角线上二分出来（co-rank），各小段互不依赖，并行合并；
+ *    所以即使最后一趟只剩一次合并，也能用满所有线程。
+ *
+ * 相等元素总取左段，二分时用同样的规则，结果与 std::stable_sort 完全一致，和线程数无关。
+ */
+
+// 小于这个长度直接顺序排序
+inline constexpr std::ptrdiff_t kParallelMergeCutoff = 1 << 15;
+// 并行合并时每个小段的最小输出长度
+inline constexpr std::ptrdiff_t kParallelMergeMinPiece = 1 << 13;
+
+/**
+ * @brief co-rank：稳定合并 a[0, lenA) 与 b[0, lenB) 时，输出的前 d 个元素里有多少个来自 a
+ */
+template <typename ItA, typename ItB, typename Compare>
+std::ptrdiff_t mergePathSplit(ItA a, std::ptrdiff_t lenA, ItB b, std::ptrdiff_t lenB, std::ptrdiff_t d,
+                              Compare comp)
+{
+    std::ptrdiff_t lo = std::max<std::ptrdiff_t>(0, d - lenB), hi = std::min(d, lenA);
+    while (lo < hi)
+    {
+        std::ptrdiff_t i = lo + (hi - lo) / 2;
+        // a[i] 不大于 b[d-i-1] 时排在它前面（相等取 a），前 d 个里至少有 i+1 个来自 a
+        if (!comp(b[d - i - 1], a[i])) lo = i + 1;
+        else hi = i;
+    }
+    return lo;
+}
+
+/**
+ * @brief 一趟并行合并：src 中相邻的段两两合并到 dst 的相同位置
+ *
+ * bounds 是各段的分界（bounds[0] = 0，最后一个等于 n），返回合并后的分界。
+ */
+template <typename SrcIt, typename DstIt, typename Compare>
+std::vector<std::ptrdiff_t> parallelMergePass(WorkStealingPool& pool, SrcIt src, DstIt dst,
+                                              const std::vector<std::ptrdiff_t>& bounds,
+                                              std::ptrdiff_t pieceLen, Compare comp)
+{
+    std::vector<std::ptrdiff_t> merged = {0};
+    TaskGroup group;
+    int runs = static_cast<int>(bounds.size()) - 1;
+    for (int r = 0; r < runs; r += 2)
+    {
+        std::ptrdiff_t lo = bounds[r], mid = bounds[r + 1], hi = r + 2 <= runs ? bounds[r + 2] : mid;
+        merged.push_back(hi);
+        for (std::ptrdiff_t d0 = 0; d0 < hi - lo; d0 += pieceLen)
+        {
+            std::ptrdiff_t d1 = std::min(d0 + pieceLen, hi - lo);
+            pool.submit(group, [=] {
+                SrcIt a = src + lo, b = src + mid;
+                std::ptrdiff_t lenA = mid - lo, lenB = hi - mid;
+                std::ptrdiff_t i0 = mergePathSplit(a, lenA, b, lenB, d0, comp);
+                std::ptrdiff_t i1 = mergePathSplit(a, lenA, b, lenB, d1, comp);
+                mergeRuns(a + i0, a + i1, b + (d0 - i0), b + (d1 - i1), dst + lo + d0, comp);
+            });
+        }
+    }
+    pool.wait(group);
+    return merged;
+}
+
+/**
+ * @brief 用已有的线程池对 [first, last) 稳定排序
+ */
+template <typename RandomIt, typename Compare = std::less<>>
+void parallelMergeSort(WorkStealingPool& pool, RandomIt first, RandomIt last, Compare comp = Compare())
+{
+    using T = typename std::iterator_traits<RandomIt>::value_type;
+    std::ptrdiff_t n = last - first;
+    if (pool.size() <= 1 || n <= kParallelMergeCutoff)
+    {
+        bottomUpMergeSort(first, last, comp);
+        return;
+    }
+    std::vector<T> buffer(n);
+    auto buf = buffer.begin();
+
+    // 1. 各块并行排序，块内用对应位置的缓冲区
+    int chunks = pool.size();
+    std::vector<std::ptrdiff_t> bounds(chunks + 1);
+    for (int c = 0; c <= chunks; c++) bounds[c] = n * c / chunks;
+    TaskGroup group;
+    for (int c = 0; c < chunks; c++)
+    {
+        std::ptrdiff_t lo = bounds[c], hi = bounds[c + 1];
+        pool.submit(group, [=] { bottomUpMergeSort(first + lo, first + hi, buf + lo, comp); });
+    }
+    pool.wait(group);
+
+    // 2. 逐趟并行合并
+    std::ptrdiff_t pieceLen = std::max(kParallelMergeMinPiece, n / (4 * pool.size()));
+    bool inBuffer = false;
+    while (bounds.size() > 2)
+    {
+        if (inBuffer) bounds = parallelMergePass(pool, buf, first, bounds, pieceLen, comp);
+        else bounds = parallelMergePass(pool, first, buf, bounds, pieceLen, comp);
+        inBuffer = !inBuffer;
+    }
+
+    // 3. 结果在缓冲区时并行搬回
+    if (inBuffer)
+    {
+        for (std::ptrdiff_t lo = 0; lo < n; lo += pieceLen)
+        {
+            std::ptrdiff_t hi = std::min(lo + pieceLen, n);
+            pool.submit(group, [=] { std::move(buf + lo, buf + hi, first + lo); });
+        }
+        pool.wait(group);
+    }
+}
+
+/**
+ * @brief 用 threads 个线程对 [first, last) 稳定排序，threads <= 0 时取硬件线程数
+ */
+template <typename RandomIt, typename Compare = std::less<>>
+void parallelMergeSort(RandomIt first, RandomIt last, Compare comp = Compare(), int threads = 0)
+{
+    if (threads == 1 || last - first <= kParallelMergeCutoff)
+    {
+        bottomUpMergeSort(first, last, comp);
+        return;
+    }
+    WorkStealingPool pool(threads);
+    parallelMergeSort(pool, first, last, comp);
+}
+
+/**
+ * @brief 与 Mergesort(a, left, right) 相同的接口，多一个线程数参数
+ */
+inline void parallelMergeSort(std::vector<int>& a, int left, int right, int threads = 0)
+{
+    if (left >= right) return;
+    parallelMergeSort(a.begin() + left, a.begin() + right + 1, std::less<>(), threads);
+}
+
+#endif  // PARALLELMERGESORT_H
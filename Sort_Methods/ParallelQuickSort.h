@@ -0,0 +1,196 @@
+// ParallelQuickSort.h
+#ifndef PARALLELQUICKSORT_H
+#define PARALLELQUICKSORT_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "IntroSort.h"
+#include "WorkStealingPool.h"
+
+/**
+ * @file ParallelQuickSort.h
+ * @brief 基于工作窃取线程池的并行快速排序
+ *
+ * - 每次分区后把较小的一侧作为任务交给线程池，较大的一侧由当前线程继续处理；
+ * - 区间小于 kParallelSortCutoff 时直接顺序 introSort，避免任务过细；
+ * - 顶层几层区间很大（>= kParallelPartitionMin），单线程分区会成为瓶颈，
+ *   这里改为并行分区：各块并行计数 -> 前缀和 -> 并行散射到缓冲区 -> 并行拷回；
+ * - 递归深度超过 2*log2(n) 时交给 introSort（内部有堆排序兜底），最坏 O(n log n)。
+ *
+ * 并行分区需要一块与区间等长的缓冲区，元素类型需要可默认构造。
+ */
+
+inline constexpr std::ptrdiff_t kParallelSortCutoff = 1 << 14;
+inline constexpr std::ptrdiff_t kParallelPartitionMin = 1 << 20;
+
+/**
+ * @brief 以 *first 为枢轴的并行分区，返回枢轴最终位置 p
+ *
+ * 默认 [first, p) 小于枢轴，(p, last) 不小于枢轴；
+ * equalLeft 为 true 时 [first, p) 不大于枢轴，(p, last) 大于枢轴（枢轴是最小值时用来跳过重复元素）。
+ */
+template <typename RandomIt, typename Compare>
+RandomIt parallelPartition(WorkStealingPool& pool, RandomIt first, RandomIt last, Compare comp,
+                           bool equalLeft = false)
+{
+    using T = typename std::iterator_traits<RandomIt>::value_type;
+    RandomIt begin = first + 1;  // 枢轴留在 *first，各任务只读它
+    std::ptrdiff_t n = last - begin;
+    int chunks = pool.size() * 4;
+    std::ptrdiff_t chunk = (n + chunks - 1) / chunks;
+    const T& pivot = *first;
+    auto goesLeft = [&](const T& x) { return equalLeft ? !comp(pivot, x) : comp(x, pivot); };
+
+    // 1. 每块数一下分到左边的元素个数
+    std::vector<std::ptrdiff_t> small(chunks, 0);
+    TaskGroup count;
+    for (int c = 0; c < chunks; c++)
+    {
+        pool.submit(count, [&, c] {
+            RandomIt b = begin + std::min(n, c * chunk), e = begin + std::min(n, (c + 1) * chunk);
+            std::ptrdiff_t k = 0;
+            for (RandomIt it = b; it != e; ++it) k += goesLeft(*it);
+            small[c] = k;
+        });
+    }
+    pool.wait(count);
+
+    // 2. 前缀和得到每块的小元素、大元素写入位置
+    std::vector<std::ptrdiff_t> smallAt(chunks), largeAt(chunks);
+    std::ptrdiff_t totalSmall = 0;
+    for (int c = 0; c < chunks; c++) totalSmall += small[c];
+    std::ptrdiff_t s = 0, l = totalSmall;
+    for (int c = 0; c < chunks; c++)
+    {
+        std::ptrdiff_t len = std::min(n, (c + 1) * chunk) - std::min(n, c * chunk);
+        smallAt[c] = s, largeAt[c] = l;
+        s += small[c], l += len - small[c];
+    }
+
+    // 3. 并行散射到缓冲区，再并行拷回（各块保持原有相对顺序）
+    std::vector<T> buffer(n);
+    TaskGroup scatter;
+    for (int c = 0; c < chunks; c++)
+    {
+        pool.submit(scatter, [&, c] {
+            RandomIt b = begin + std::min(n, c * chunk), e = begin + std::min(n, (c + 1) * chunk);
+            std::ptrdiff_t si = smallAt[c], li = largeAt[c];
+            for (RandomIt it = b; it != e; ++it)
+            {
+                if (goesLeft(*it)) buffer[si++] = std::move(*it);
+                else buffer[li++] = std::move(*it);
+            }
+        });
+    }
+    pool.wait(scatter);
+    TaskGroup copyBack;
+    for (int c = 0; c < chunks; c++)
+    {
+        pool.submit(copyBack, [&, c] {
+            std::ptrdiff_t b = std::min(n, c * chunk), e = std::min(n, (c + 1) * chunk);
+            std::move(buffer.begin() + b, buffer.begin() + e, begin + b);
+        });
+    }
+    pool.wait(copyBack);
+
+    // 4. 枢轴与左边最后一个元素交换
+    RandomIt p = begin + totalSmall - 1;
+    std::iter_swap(first, p);
+    return p;
+}
+
+template <typename RandomIt, typename Compare>
+void parallelQuickSortTask(WorkStealingPool& pool, TaskGroup& group, RandomIt first, RandomIt last,
+                           Compare comp, int depthLimit)
+{
+    while (last - first > kParallelSortCutoff)
+    {
+        if (depthLimit == 0)
+        {
+            introSort(first, last, comp);
+            return;
+        }
+        depthLimit--;
+        choosePivot(first, last, comp);
+        RandomIt p;
+        if (last - first >= kParallelPartitionMin)
+        {
+            p = parallelPartition(pool, first, last, comp);
+            if (p == first)
+            {
+                // 枢轴是最小值（大量重复元素）：把等于它的元素一次归到左边，左边已经有序
+                p = parallelPartition(pool, first, last, comp, true);
+                first = p + 1;
+                continue;
+            }
+        }
+        else
+        {
+            p = partitionForSort(first, last, comp);
+        }
+        RandomIt a = p + 1, b = last;  // 交给线程池的一侧，默认右侧
+        if (p - first < last - p)
+        {
+            a = first, b = p;
+            first = p + 1;
+        }
+        else
+        {
+            last = p;
+        }
+        pool.submit(group, [&pool, &group, a, b, comp, depthLimit] {
+            parallelQuickSortTask(pool, group, a, b, comp, depthLimit);
+        });
+    }
+    introSort(first, last, comp);
+}
+
+/**
+ * @brief 用已有的线程池并行排序 [first, last)
+ */
+template <typename RandomIt, typename Compare = std::less<>>
+void parallelQuickSort(WorkStealingPool& pool, RandomIt first, RandomIt last, Compare comp = Compare())
+{
+    std::ptrdiff_t n = last - first;
+    if (pool.size() <= 1 || n <= kParallelSortCutoff)
+    {
+        introSort(first, last, comp);
+        return;
+    }
+    int depthLimit = 0;
+    for (std::ptrdiff_t k = n; k > 1; k >>= 1) depthLimit += 2;
+    TaskGroup group;
+    parallelQuickSortTask(pool, group, first, last, comp, depthLimit);
+    pool.wait(group);
+}
+
+/**
+ * @brief 用 threads 个线程并行排序 [first, last)，threads <= 0 时取硬件线程数
+ */
+template <typename RandomIt, typename Compare = std::less<>>
+void parallelQuickSort(RandomIt first, RandomIt last, Compare comp = Compare(), int threads = 0)
+{
+    if (threads == 1 || last - first <= kParallelSortCutoff)
+    {
+        introSort(first, last, comp);
+        return;
+    }
+    WorkStealingPool pool(threads);
+    parallelQuickSort(pool, first, last, comp);
+}
+
+/**
+ * @brief 与 quickSort(a, left, right) 相同的接口，多一个线程数参数
+ */
+inline void parallelQuickSort(std::vector<int>& a, int left, int right, int threads = 0)
+{
+    if (left >= right) return;
+    parallelQuickSort(a.begin() + left, a.begin() + right + 1, std::less<>(), threads);
+}
+
+#endif  // PARALLELQUICKSORT_H
@@ -0,0 +1,204 @@
+// ParallelSampleSort.h
+#ifndef PARALLELSAMPLESORT_H
+#define PARALLELSAMPLESORT_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "IntroSort.h"
+#include "ParallelQuickSort.h"
+#include "WorkStealingPool.h"
+
+/**
+ * @file ParallelSampleSort.h
+ * @brief 并行样本排序（sample sort）：一次分成很多个桶，第一层划分也是并行的
+ *
+ * 1. 随机抽 k * kSampleOversampling 个样本排序，等距取 k - 1 个作为分隔值（splitter），
+ *    过采样让各桶大小接近 n / k；
+ * 2. 分隔值按层序（Eytzinger 布局）存成一棵完全二叉搜索树，每个元素从根走 log2 k 层：
+ *    j = 2 * j + comp(tree[j], x)，没有分支，不会有分支预测失败；
+ *    再多比较一次是否等于桶的上界分隔值，等于的进“相等桶”，相等桶不需要再排序，重复值很多时也不会失衡；
+ * 3. 各块并行分类，桶号记在一个 uint16 数组里，同时计数；
+ *    前缀和得到每块每桶的写入位置，各块再按记下的桶号并行散射到缓冲区，元素只比较一遍；
+ * 4. 各桶作为独立任务并行排序后搬回：普通大小的桶顺序 introSort，
+ *    特别大的桶（超过平均每线程的份额）交给 parallelQuickSort 继续并行分区。
+ *
+ * 不稳定。需要一块与区间等长的缓冲区，元素类型需要可默认构造。
+ */
+
+// 小于这个长度直接交给 parallelQuickSort（其内部再按 kParallelSortCutoff 退回顺序排序）
+inline constexpr std::ptrdiff_t kSampleSortCutoff = 1 << 18;
+// 每个桶抽多少个样本
+inline constexpr int kSampleOversampling = 16;
+// 最多 2^kSampleSortMaxLog 个桶，分类树的深度
+inline constexpr int kSampleSortMaxLog = 10;
+
+namespace sample_sort_detail
+{
+
+// 把有序的 splitters 按层序填进 tree[1, k)，tree[j] 的左右孩子是 tree[2j]、tree[2j+1]
+template <typename T>
+void buildTree(const std::vector<T>& splitters, std::vector<T>& tree, std::size_t j, std::size_t lo,
+               std::size_t hi)
+{
+    if (j >= tree.size()) return;
+    std::size_t mid = lo + (hi - lo) / 2;
+    tree[j] = splitters[mid];
+    buildTree(splitters, tree, 2 * j, lo, mid);
+    buildTree(splitters, tree, 2 * j + 1, mid + 1, hi);
+}
+
+// 分类器：桶 2b 放 (splitters[b-1], splitters[b]) 内的元素，桶 2b + 1 放等于 splitters[b] 的元素
+template <typename T, typename Compare>
+struct Classifier
+{
+    std::vector<T> tree;       // 层序的分隔值，tree[0] 不用
+    std::vector<T> upper;      // upper[b] 是桶 b 的上界；最后一个桶没有上界，只占位，结果被屏蔽
+    int logBuckets;
+    Compare comp;
+
+    int operator()(const T& x) const
+    {
+        std::size_t j = 1;
+        for (int level = 0; level < logBuckets; level++) j = 2 * j + comp(tree[j], x);
+        std::size_t b = j - (std::size_t(1) << logBuckets);
+        bool equal = (b + 1 < upper.size()) & !comp(x, upper[b]);  // 用 & 而不是 &&，不引入分支
+        return static_cast<int>(2 * b + equal);
+    }
+};
+
+}  // namespace sample_sort_detail
+
+/**
+ * @brief 用已有的线程池并行排序 [first, last)
+ */
+template <typename RandomIt, typename Compare = std::less<>>
+void parallelSampleSort(WorkStealingPool& pool, RandomIt first, RandomIt last, Compare comp = Compare())
+{
+    using namespace sample_sort_detail;
+    using T = typename std::iterator_traits<RandomIt>::value_type;
+    std::ptrdiff_t n = last - first;
+    if (pool.size() <= 1 || n <= kSampleSortCutoff)
+    {
+        parallelQuickSort(pool, first, last, comp);
+        return;
+    }
+
+    // 1. 桶数取 2 的幂：约每线程 8 个桶，每桶不少于 kParallelSortCutoff 个元素
+    int logBuckets = 1;
+    while (logBuckets < kSampleSortMaxLog && (std::ptrdiff_t(1) << logBuckets) < 8 * pool.size() &&
+           (n >> (logBuckets + 1)) >= kParallelSortCutoff)
+        logBuckets++;
+    std::size_t k = std::size_t(1) << logBuckets;
+
+    // 2. 过采样选分隔值（固定种子，结果可复现）
+    std::mt19937_64 rng(static_cast<std::uint64_t>(n));
+    std::vector<T> sample(k * kSampleOversampling);
+    for (T& x : sample) x = first[static_cast<std::ptrdiff_t>(rng() % static_cast<std::uint64_t>(n))];
+    introSort(sample.begin(), sample.end(), comp);
+    std::vector<T> splitters(k - 1);
+    for (std::size_t i = 0; i + 1 < k; i++) splitters[i] = sample[(i + 1) * kSampleOversampling - 1];
+    Classifier<T, Compare> classify{std::vector<T>(k), splitters, logBuckets, comp};
+    buildTree(splitters, classify.tree, 1, 0, splitters.size());
+    classify.upper.push_back(splitters.back());
+    int buckets = static_cast<int>(2 * k);
+
+    // 3. 各块并行分类并计数，桶号记下来，散射时不再比较
+    int chunks = pool.size() * 2;
+    std::ptrdiff_t chunk = (n + chunks - 1) / chunks;
+    std::vector<std::uint16_t> oracle(n);
+    std::vector<std::ptrdiff_t> counts(static_cast<std::size_t>(chunks) * buckets, 0);
+    TaskGroup group;
+    for (int c = 0; c < chunks; c++)
+    {
+        pool.submit(group, [&, c] {
+            std::ptrdiff_t b = std::min(n, c * chunk), e = std::min(n, (c + 1) * chunk);
+            std::ptrdiff_t* count = &counts[static_cast<std::size_t>(c) * buckets];
+            for (std::ptrdiff_t i = b; i < e; i++)
+            {
+                int bucket = classify(first[i]);
+                oracle[i] = static_cast<std::uint16_t>(bucket);
+                count[bucket]++;
+            }
+        });
+    }
+    pool.wait(group);
+
+    // 前缀和：桶按顺序排列，同一个桶里各块按块号排列；counts 改为写入位置
+    std::vector<std::ptrdiff_t> bucketStart(buckets + 1);
+    std::ptrdiff_t offset = 0;
+    for (int bucket = 0; bucket < buckets; bucket++)
+    {
+        bucketStart[bucket] = offset;
+        for (int c = 0; c < chunks; c++)
+        {
+            std::ptrdiff_t& slot = counts[static_cast<std::size_t>(c) * buckets + bucket];
+            std::ptrdiff_t len = slot;
+            slot = offset;
+            offset += len;
+        }
+    }
+    bucketStart[buckets] = n;
+
+    // 4. 并行散射到缓冲区
+    std::vector<T> buffer(n);
+    for (int c = 0; c < chunks; c++)
+    {
+        pool.submit(group, [&, c] {
+            std::ptrdiff_t b = std::min(n, c * chunk), e = std::min(n, (c + 1) * chunk);
+            std::ptrdiff_t* at = &counts[static_cast<std::size_t>(c) * buckets];
+            for (std::ptrdiff_t i = b; i < e; i++) buffer[at[oracle[i]]++] = std::move(first[i]);
+        });
+    }
+    pool.wait(group);
+
+    // 5. 各桶并行排序并搬回；相等桶只搬回
+    std::ptrdiff_t fairShare = n / pool.size();
+    for (int bucket = 0; bucket < buckets; bucket++)
+    {
+        std::ptrdiff_t lo = bucketStart[bucket], hi = bucketStart[bucket + 1];
+        if (lo == hi) continue;
+        pool.submit(group, [&pool, &buffer, first, comp, lo, hi, fairShare, equal = bucket % 2 == 1] {
+            auto b = buffer.begin() + lo, e = buffer.begin() + hi;
+            if (!equal)
+            {
+                if (hi - lo > fairShare) parallelQuickSort(pool, b, e, comp);
+                else introSort(b, e, comp);
+            }
+            std::move(b, e, first + lo);
+        });
+    }
+    pool.wait(group);
+}
+
+/**
+ * @brief 用 threads 个线程并行排序 [first, last)，threads <= 0 时取硬件线程数
+ */
+template <typename RandomIt, typename Compare = std::less<>>
+void parallelSampleSort(RandomIt first, RandomIt last, Compare comp = Compare(), int threads = 0)
+{
+    if (threads == 1 || last - first <= kParallelSortCutoff)
+    {
+        introSort(first, last, comp);
+        return;
+    }
+    WorkStealingPool pool(threads);
+    parallelSampleSort(pool, first, last, comp);
+}
+
+/**
+ * @brief 与 quickSort(a, left, right) 相同的接口，多一个线程数参数
+ */
+inline void parallelSampleSort(std::vector<int>& a, int left, int right, int threads = 0)
+{
+    if (left >= right) return;
+    parallelSampleSort(a.begin() + left, a.begin() + right + 1, std::less<>(), threads);
+}
+
+#endif  // PARALLELSAMPLESORT_H
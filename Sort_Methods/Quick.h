@@ -4,6 +4,9 @@
 
 #include <vector>
 #include <algorithm>
+#include <utility>
+
+#include "IntroSort.h"
 
 /**
  * @file quicksort.h
@@ -15,7 +18,9 @@
 /**
  * @brief 分区函数（原percision函数）
  * 
- * 使用Hoare分区方案，将数组分为两部分：
+ * 先用三数中值（区间较大时用 ninther）选出 pivot 换到 a[left]，
+ * 有序或逆序的输入也能分得均匀；然后用 BlockPartition.h 的无分支块分区，
+ * 将数组分为两部分：
  * - 左边：小于等于pivot的元素
  * - 右边：大于等于pivot的元素
  * 
@@ -26,10 +31,29 @@
  */
 int partition(std::vector<int>& a, int left, int right);
 
+/**
+ * @brief 三路分区函数
+ *
+ * 选 pivot 的方式与 partition 相同，然后用 Bentley–McIlroy 三路分区
+ * 将数组分为三部分：
+ * - 左边：小于pivot的元素
+ * - 中间：等于pivot的元素，已经在最终位置上
+ * - 右边：大于pivot的元素
+ * 重复值很多时（例如只有几十种取值），调用方可以整段跳过中间部分。
+ *
+ * @param a 待分区的数组引用
+ * @param left 分区左边界（包含）
+ * @param right 分区右边界（包含）
+ * @return std::pair<int, int> 等于pivot的一段 [first, second]（都包含）
+ */
+std::pair<int, int> partition3(std::vector<int>& a, int left, int right);
+
 /**
  * @brief 快速排序主函数
  * 
- * 对数组a中[left, right]范围内的元素进行快速排序
+ * 对数组a中[left, right]范围内的元素进行快速排序。
+ * 实现为 introSort（见 IntroSort.h）：ninther 选枢轴、小区间插入排序、
+ * 递归过深时改用堆排序，最坏 O(n log n)；大量重复值时自动切换到三路分区。
  * 
  * @param a 待排序的数组引用
  * @param left 排序左边界
@@ -7,24 +7,25 @@ using namespace std;
 
 int partition(vector<int>& a,int left,int right)
 {
-    int pivot = a[right];
-    int i = left, j = right;
-
-    while(i < j)
+    if (right - left < 2)
     {
-        while(i < j && a[i] <= pivot) i++;
-        while(i < j && a[j] >= pivot) j--;
-        if(i < j) swap(a[i], a[j]);
+        // 不足三个元素，没法取中值，直接用 Hoare 分区
+        return partitionAroundFirst(a.begin()+left, a.begin()+right+1, less<int>()) - a.begin();
     }
-    swap(a[i], a[right]);
-    return i;
+    // 三数取中后把 pivot 换到 a[left]，再做无分支的块分区
+    choosePivot(a.begin()+left, a.begin()+right+1, less<int>());
+    return blockPartitionAroundFirst(a.begin()+left, a.begin()+right+1, less<int>()) - a.begin();
+}
+
+pair<int, int> partition3(vector<int>& a,int left,int right)
+{
+    if (right - left >= 2) choosePivot(a.begin()+left, a.begin()+right+1, less<int>());
+    auto [lo, hi] = partitionThreeWay(a.begin()+left, a.begin()+right+1, less<int>());
+    return {int(lo - a.begin()), int(hi - a.begin()) - 1};
 }
 
-void Quicksort(vector<int>& a,int left,int right)
+void quickSort(vector<int>& a,int left,int right)
 {
-    int i=left,j=right;
     if (left >= right) return;
-    int piv_idx = partition(a,left,right);
-    Quicksort(a,i,piv_idx -1);
-    Quicksort(a,piv_idx+1,right);
+    introSort(a.begin()+left, a.begin()+right+1);
 }
@@ -0,0 +1,138 @@
+// RadixSort.h
+#ifndef RADIXSORT_H
+#define RADIXSORT_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @file RadixSort.h
+ * @brief 整数键的 LSD 基数排序
+ *
+ * - 每趟按一个数字位（digit）做计数排序，从低位到高位；n 较大时每位 11 bit
+ *   （32 位键 3 趟，64 位键 6 趟），n 较小时 8 bit，避免前缀和本身比数据还多；
+ * - 所有趟的直方图在一次读数据时同时统计出来，之后每趟只做一次分发；
+ * - 某一位上所有键都相同（直方图里只有一个桶非空）时整趟跳过，
+ *   例如值域很小的 64 位键只需要一两趟；
+ * - 有符号整数把符号位取反后按无符号比较，负数自然排在前面；
+ * - 源和目标在原数组与缓冲区之间乒乓，最后一次性搬回。
+ *
+ * 稳定，O(passes * n)，需要 n 个元素的辅助缓冲区；只适用于连续存储（vector、数组）。
+ */
+
+// 少于这么多元素时直接插入排序
+inline constexpr std::size_t kRadixInsertionCutoff = 64;
+// 少于这么多元素时用 8 bit 的数字位
+inline constexpr std::size_t kRadixSmallN = 1 << 16;
+
+/**
+ * @brief 把整数映射为保序的无符号键：有符号类型翻转符号位
+ */
+template <typename T>
+std::make_unsigned_t<T> radixKey(T x)
+{
+    static_assert(std::is_integral_v<T> && !std::is_same_v<T, bool>, "radixKey 只支持 bool 以外的整数");
+    using U = std::make_unsigned_t<T>;
+    U u = static_cast<U>(x);
+    if constexpr (std::is_signed_v<T>) u ^= U(1) << (std::numeric_limits<U>::digits - 1);
+    return u;
+}
+
+template <int Bits, typename T, typename KeyOf>
+void lsdRadixSortImpl(T* data, T* buffer, std::size_t n, KeyOf keyOf)
+{
+    using U = std::decay_t<decltype(keyOf(*data))>;
+    constexpr int kRadix = 1 << Bits;
+    constexpr U kMask = kRadix - 1;
+    constexpr int kPasses = (std::numeric_limits<U>::digits + Bits - 1) / Bits;
+
+    // 一次读数据统计所有趟的直方图
+    std::vector<std::size_t> count(static_cast<std::size_t>(kPasses) * kRadix, 0);
+    for (std::size_t i = 0; i < n; i++)
+    {
+        U k = keyOf(data[i]);
+        for (int p = 0; p < kPasses; p++) count[p * kRadix + ((k >> (p * Bits)) & kMask)]++;
+    }
+
+    T* src = data;
+    T* dst = buffer;
+    U first = keyOf(data[0]);
+    for (int p = 0; p < kPasses; p++)
+    {
+        std::size_t* c = count.data() + p * kRadix;
+        if (c[(first >> (p * Bits)) & kMask] == n) continue;  // 这一位所有键都相同
+
+        std::size_t sum = 0;
+        for (int d = 0; d < kRadix; d++)
+        {
+            std::size_t k = c[d];
+            c[d] = sum;
+            sum += k;
+        }
+        for (std::size_t i = 0; i < n; i++) dst[c[(keyOf(src[i]) >> (p * Bits)) & kMask]++] = std::move(src[i]);
+        std::swap(src, dst);
+    }
+    if (src != data) std::move(src, src + n, data);
+}
+
+/**
+ * @brief 按 keyOf 给出的无符号整数键稳定排序 data[0, n)，buffer 至少 n 个元素
+ */
+template <typename T, typename KeyOf>
+void radixSortBy(T* data, T* buffer, std::size_t n, KeyOf keyOf)
+{
+    using U = std::decay_t<decltype(keyOf(*data))>;
+    static_assert(std::is_unsigned_v<U>, "radixSortBy 的键必须是无符号整数，有符号键先用 radixKey 映射");
+    if (n < kRadixInsertionCutoff)
+    {
+        // 稳定的插入排序
+        for (std::size_t i = 1; i < n; i++)
+        {
+            T x = std::move(data[i]);
+            U k = keyOf(x);
+            std::size_t j = i;
+            for (; j > 0 && k < keyOf(data[j - 1]); j--) data[j] = std::move(data[j - 1]);
+            data[j] = std::move(x);
+        }
+        return;
+    }
+    if (n < kRadixSmallN) lsdRadixSortImpl<8>(data, buffer, n, keyOf);
+    else lsdRadixSortImpl<11>(data, buffer, n, keyOf);
+}
+
+/**
+ * @brief 对连续存储的整数区间 [first, last) 升序排序
+ *
+ * 只接受连续迭代器（vector、array、原生数组）；deque 之类的区间不能当作一块内存访问，编译期拒绝。
+ */
+template <typename RandomIt>
+    requires std::contiguous_iterator<RandomIt>
+void radixSort(RandomIt first, RandomIt last)
+{
+    using T = typename std::iterator_traits<RandomIt>::value_type;
+    static_assert(std::is_integral_v<T> && !std::is_same_v<T, bool>, "radixSort 只支持 bool 以外的整数");
+    std::size_t n = last - first;
+    if (n < 2) return;
+    T* data = std::to_address(first);
+    // 缓冲区不需要初始化，分发时会整体覆盖
+    auto buffer = std::make_unique_for_overwrite<T[]>(n < kRadixInsertionCutoff ? 0 : n);
+    radixSortBy(data, buffer.get(), n, [](T x) { return radixKey(x); });
+}
+
+/**
+ * @brief 与 quickSort(a, left, right) 相同的接口
+ */
+inline void radixSort(std::vector<int>& a, int left, int right)
+{
+    if (left >= right) return;
+    radixSort(a.begin() + left, a.begin() + right + 1);
+}
+
+#endif  // RADIXSORT_H
@@ -0,0 +1,228 @@
+// SortingNetwork.h
+#ifndef SORTINGNETWORK_H
+#define SORTINGNETWORK_H
+
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#include <immintrin.h>
+#define SORTING_NETWORK_AVX2 1
+#endif
+
+/**
+ * @file SortingNetwork.h
+ * @brief 小块 int32 的 AVX2 双调（bitonic）排序网络
+ *
+ * - 8 个 int32 正好放进一个 256 位寄存器，寄存器内的双调排序 6 步完成：
+ *   每步用 shuffle/permute 取出配对的元素，min/max 后按掩码 blend 回去；
+ * - 16/32/64 个元素先各寄存器内部排好，再两两做双调合并（反转后一段、逐寄存器 min/max，
+ *   然后寄存器之间、寄存器内部各做半清洁器），整个过程没有分支；
+ * - 运行时用 __builtin_cpu_supports("avx2") 检测一次，AVX2 代码用 target 属性单独编译，
+ *   不需要 -mavx2，不支持的 CPU（或非 x86 平台）退回插入排序；
+ * - 不满一块时用掩码读写，空位补 INT32_MAX 凑满 8/16/32/64，不会越界访问。
+ *
+ * introSort 和 bottomUpMergeSort 在 int 配 std::less 的连续数组上用它做小区间的基本情况；
+ * sortNetworkBlocks 可以一次排很多个等长小数组。
+ */
+
+inline constexpr int kSortNetworkMax = 64;
+
+// 只有“int32 + 升序 + 连续存储”时才走排序网络
+template <typename RandomIt, typename Compare>
+struct UseSortingNetwork
+    : std::bool_constant<std::is_same_v<typename std::iterator_traits<RandomIt>::value_type, std::int32_t> &&
+                         std::contiguous_iterator<RandomIt> &&
+                         (std::is_same_v<Compare, std::less<>> || std::is_same_v<Compare, std::less<std::int32_t>>)>
+{
+};
+
+namespace sorting_network_detail
+{
+
+inline void insertionSort(std::int32_t* a, int n)
+{
+    for (int i = 1; i < n; i++)
+    {
+        std::int32_t x = a[i];
+        int j = i;
+        for (; j > 0 && x < a[j - 1]; j--) a[j] = a[j - 1];
+        a[j] = x;
+    }
+}
+
+#ifdef SORTING_NETWORK_AVX2
+
+inline bool hasAvx2()
+{
+    static const bool has = __builtin_cpu_supports("avx2");
+    return has;
+}
+
+// 与 partner 做比较交换，mask 中为 1 的位取较大值
+#define SORTING_NETWORK_STEP(v, partner, mask)                                                        \
+    do                                                                                                \
+    {                                                                                                 \
+        __m256i p_ = (partner);                                                                       \
+        v = _mm256_blend_epi32(_mm256_min_epi32(v, p_), _mm256_max_epi32(v, p_), (mask));             \
+    } while (0)
+
+__attribute__((target("avx2"))) inline __m256i swapHalves(__m256i v)
+{
+    return _mm256_permute2x128_si256(v, v, 0x01);
+}
+
+__attribute__((target("avx2"))) inline __m256i reverseLanes(__m256i v)
+{
+    return _mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+}
+
+// 寄存器内完整的 8 元素双调排序
+__attribute__((target("avx2"))) inline __m256i sortRegister(__m256i v)
+{
+    SORTING_NETWORK_STEP(v, _mm256_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)), 0x66);
+    SORTING_NETWORK_STEP(v, _mm256_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)), 0x3C);
+    SORTING_NETWORK_STEP(v, _mm256_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)), 0x5A);
+    SORTING_NETWORK_STEP(v, swapHalves(v), 0xF0);
+    SORTING_NETWORK_STEP(v, _mm256_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)), 0xCC);
+    SORTING_NETWORK_STEP(v, _mm256_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)), 0xAA);
+    return v;
+}
+
+// 寄存器内的双调合并：输入是双调序列，输出升序
+__attribute__((target("avx2"))) inline __m256i mergeRegister(__m256i v)
+{
+    SORTING_NETWORK_STEP(v, swapHalves(v), 0xF0);
+    SORTING_NETWORK_STEP(v, _mm256_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)), 0xCC);
+    SORTING_NETWORK_STEP(v, _mm256_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)), 0xAA);
+    return v;
+}
+
+#undef SORTING_NETWORK_STEP
+
+// m 个寄存器组成的双调序列合并成升序
+__attribute__((target("avx2"))) inline void bitonicMerge(__m256i* v, int m)
+{
+    for (int half = m / 2; half >= 1; half /= 2)
+    {
+        for (int g = 0; g < m; g += 2 * half)
+        {
+            for (int i = g; i < g + half; i++)
+            {
+                __m256i lo = _mm256_min_epi32(v[i], v[i + half]);
+                v[i + half] = _mm256_max_epi32(v[i], v[i + half]);
+                v[i] = lo;
+            }
+        }
+    }
+    for (int i = 0; i < m; i++) v[i] = mergeRegister(v[i]);
+}
+
+// v[0, k) 与 v[k, 2k) 各自升序，合并成 v[0, 2k) 升序（k <= 4）
+__attribute__((target("avx2"))) inline void mergeSortedHalves(__m256i* v, int k)
+{
+    // 后一半整体反转后与前一半逐个比较，得到两个双调序列，且前者都不大于后者
+    __m256i rev[4];
+    for (int i = 0; i < k; i++) rev[i] = reverseLanes(v[2 * k - 1 - i]);
+    for (int i = 0; i < k; i++)
+    {
+        __m256i lo = _mm256_min_epi32(v[i], rev[i]);
+        v[k + i] = _mm256_max_epi32(v[i], rev[i]);
+        v[i] = lo;
+    }
+    bitonicMerge(v, k);
+    bitonicMerge(v + k, k);
+}
+
+template <int Regs>
+__attribute__((target("avx2"))) void sortBlockAvx2(std::int32_t* a)
+{
+    __m256i v[Regs];
+    for (int i = 0; i < Regs; i++) v[i] = sortRegister(_mm256_loadu_si256(reinterpret_cast<__m256i*>(a + 8 * i)));
+    for (int k = 1; k < Regs; k *= 2)
+    {
+        for (int g = 0; g < Regs; g += 2 * k) mergeSortedHalves(v + g, k);
+    }
+    for (int i = 0; i < Regs; i++) _mm256_storeu_si256(reinterpret_cast<__m256i*>(a + 8 * i), v[i]);
+}
+
+// 不满 8 * Regs 个元素：用掩码读写，空位补 INT32_MAX，排序后自然落在末尾
+template <int Regs>
+__attribute__((target("avx2"))) void sortPartialBlockAvx2(std::int32_t* a, int n)
+{
+    const __m256i lane = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i fill = _mm256_set1_epi32(INT32_MAX);
+    __m256i v[Regs], mask[Regs];
+    for (int i = 0; i < Regs; i++)
+    {
+        mask[i] = _mm256_cmpgt_epi32(_mm256_set1_epi32(n - 8 * i), lane);
+        __m256i x = _mm256_maskload_epi32(a + 8 * i, mask[i]);
+        v[i] = sortRegister(_mm256_blendv_epi8(fill, x, mask[i]));
+    }
+    for (int k = 1; k < Regs; k *= 2)
+    {
+        for (int g = 0; g < Regs; g += 2 * k) mergeSortedHalves(v + g, k);
+    }
+    for (int i = 0; i < Regs; i++) _mm256_maskstore_epi32(a + 8 * i, mask[i], v[i]);
+}
+
+template <int Regs>
+__attribute__((target("avx2"))) void sortBlocksAvx2(std::int32_t* data, std::size_t count)
+{
+    for (std::size_t b = 0; b < count; b++) sortBlockAvx2<Regs>(data + b * 8 * Regs);
+}
+
+#endif  // SORTING_NETWORK_AVX2
+
+}  // namespace sorting_network_detail
+
+/**
+ * @brief 用排序网络对 a[0, n) 升序排序，n <= kSortNetworkMax
+ */
+inline void sortNetwork(std::int32_t* a, int n)
+{
+    using namespace sorting_network_detail;
+    if (n < 2) return;
+#ifdef SORTING_NETWORK_AVX2
+    if (hasAvx2())
+    {
+        if (n == 8) sortBlockAvx2<1>(a);
+        else if (n == 16) sortBlockAvx2<2>(a);
+        else if (n == 32) sortBlockAvx2<4>(a);
+        else if (n == 64) sortBlockAvx2<8>(a);
+        else if (n < 8) sortPartialBlockAvx2<1>(a, n);
+        else if (n < 16) sortPartialBlockAvx2<2>(a, n);
+        else if (n < 32) sortPartialBlockAvx2<4>(a, n);
+        else sortPartialBlockAvx2<8>(a, n);
+        return;
+    }
+#endif
+    insertionSort(a, n);
+}
+
+/**
+ * @brief 一次排 count 个连续存放的小数组，每个长 blockSize（8、16、32 或 64）
+ *
+ * CPU 检测和分派只做一次，适合成批的小数组（例如按组排序后的每组数据）。
+ */
+inline void sortNetworkBlocks(std::int32_t* data, std::size_t count, int blockSize)
+{
+    using namespace sorting_network_detail;
+#ifdef SORTING_NETWORK_AVX2
+    if (hasAvx2() && (blockSize == 8 || blockSize == 16 || blockSize == 32 || blockSize == 64))
+    {
+        if (blockSize == 8) sortBlocksAvx2<1>(data, count);
+        else if (blockSize == 16) sortBlocksAvx2<2>(data, count);
+        else if (blockSize == 32) sortBlocksAvx2<4>(data, count);
+        else sortBlocksAvx2<8>(data, count);
+        return;
+    }
+#endif
+    for (std::size_t b = 0; b < count; b++) insertionSort(data + b * blockSize, blockSize);
+}
+
+#endif  // SORTINGNETWORK_H
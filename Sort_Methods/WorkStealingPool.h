@@ -0,0 +1,182 @@
+// WorkStealingPool.h
+#ifndef WORKSTEALINGPOOL_H
+#define WORKSTEALINGPOOL_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @file WorkStealingPool.h
+ * @brief 分治算法用的工作窃取线程池（fork-join）
+ *
+ * - 每个线程有自己的双端队列：自己从尾部压入、弹出（LIFO，缓存友好），
+ *   空闲时从别人队列的头部偷任务（FIFO，偷到的通常是较大的子问题）；
+ * - 任务挂在 TaskGroup 上，wait(group) 的线程不会干等，而是一边执行任务一边等，
+ *   递归地 fork-join 也不会死锁；
+ * - 调用 wait 的外部线程（通常是主线程）占用 0 号队列，也算一个工作线程，
+ *   所以 WorkStealingPool(8) 只额外创建 7 个线程。
+ *
+ * 队列用互斥锁保护，任务粒度由调用方的顺序阈值保证足够大，锁的开销可以忽略。
+ */
+
+// 一组可以一起等待的任务
+class TaskGroup
+{
+   private:
+    friend class WorkStealingPool;
+    std::atomic<long> pending{0};
+
+   public:
+    bool done() const
+    {
+        return pending.load(std::memory_order_acquire) == 0;
+    }
+};
+
+class WorkStealingPool
+{
+   private:
+    struct Task
+    {
+        std::function<void()> run;
+        TaskGroup* group;
+    };
+
+    struct Queue
+    {
+        std::mutex lock;
+        std::deque<Task> tasks;
+    };
+
+    int numThreads;
+    std::vector<std::unique_ptr<Queue>> queues;
+    std::vector<std::thread> workers;
+    std::atomic<bool> stopping{false};
+    std::atomic<long> queued{0};
+    std::mutex sleepLock;
+    std::condition_variable wakeUp;
+
+    struct WorkerId
+    {
+        const WorkStealingPool* pool = nullptr;
+        int index = 0;
+    };
+
+    static WorkerId& currentWorker()
+    {
+        thread_local WorkerId id;
+        return id;
+    }
+
+    // 当前线程在本池中的队列编号，池外线程（包括别的池的线程）为 0
+    int slot() const
+    {
+        const WorkerId& id = currentWorker();
+        return id.pool == this ? id.index : 0;
+    }
+
+    bool popLocal(int me, Task& out)
+    {
+        Queue& q = *queues[me];
+        std::lock_guard<std::mutex> guard(q.lock);
+        if (q.tasks.empty()) return false;
+        out = std::move(q.tasks.back());
+        q.tasks.pop_back();
+        return true;
+    }
+
+    bool steal(int me, Task& out)
+    {
+        for (int k = 1; k < numThreads; k++)
+        {
+            Queue& q = *queues[(me + k) % numThreads];
+            std::lock_guard<std::mutex> guard(q.lock);
+            if (q.tasks.empty()) continue;
+            out = std::move(q.tasks.front());
+            q.tasks.pop_front();
+            return true;
+        }
+        return false;
+    }
+
+    // 取一个任务并执行，没有任务返回 false
+    bool runOne(int me)
+    {
+        Task t;
+        if (!popLocal(me, t) && !steal(me, t)) return false;
+        queued.fetch_sub(1, std::memory_order_relaxed);
+        t.run();
+        t.group->pending.fetch_sub(1, std::memory_order_acq_rel);
+        return true;
+    }
+
+    void workerLoop(int me)
+    {
+        currentWorker() = {this, me};
+        while (!stopping.load(std::memory_order_acquire))
+        {
+            if (runOne(me)) continue;
+            std::unique_lock<std::mutex> guard(sleepLock);
+            wakeUp.wait_for(guard, std::chrono::milliseconds(1), [this] {
+                return stopping.load(std::memory_order_acquire) ||
+                       queued.load(std::memory_order_acquire) > 0;
+            });
+        }
+    }
+
+   public:
+    explicit WorkStealingPool(int threads = 0)
+    {
+        if (threads <= 0) threads = static_cast<int>(std::thread::hardware_concurrency());
+        numThreads = threads > 0 ? threads : 1;
+        for (int i = 0; i < numThreads; i++) queues.push_back(std::make_unique<Queue>());
+        for (int i = 1; i < numThreads; i++) workers.emplace_back(&WorkStealingPool::workerLoop, this, i);
+    }
+
+    ~WorkStealingPool()
+    {
+        stopping.store(true, std::memory_order_release);
+        wakeUp.notify_all();
+        for (auto& w : workers) w.join();
+    }
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    int size() const
+    {
+        return numThreads;
+    }
+
+    // 把任务压入当前线程自己的队列
+    void submit(TaskGroup& group, std::function<void()> fn)
+    {
+        group.pending.fetch_add(1, std::memory_order_relaxed);
+        Queue& q = *queues[slot()];
+        {
+            std::lock_guard<std::mutex> guard(q.lock);
+            q.tasks.push_back({std::move(fn), &group});
+        }
+        queued.fetch_add(1, std::memory_order_release);
+        wakeUp.notify_one();
+    }
+
+    // 等待 group 中的任务全部完成，等待期间帮忙执行任务
+    void wait(TaskGroup& group)
+    {
+        int me = slot();
+        while (!group.done())
+        {
+            if (!runOne(me)) std::this_thread::yield();
+        }
+    }
+};
+
+#endif  // WORKSTEALINGPOOL_H
@@ -0,0 +1,126 @@
+// ConcurrentDisjointSet.h
+#ifndef CONCURRENTDISJOINTSET_H
+#define CONCURRENTDISJOINTSET_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+/**
+ * @file ConcurrentDisjointSet.h
+ * @brief 多线程可同时调用的无锁并查集
+ *
+ * 思路（Anderson-Woll / Jayanti-Tarjan）：
+ * - parent 数组全部是 atomic<uint32_t>，根满足 parent[x] == x；
+ * - find 用 CAS 做路径减半，CAS 失败说明别的线程已经改过，直接忽略，
+ *   所以 find 的步数只受路径长度限制，不会等待其他线程；
+ * - unite 只在“根仍然是根”时用 CAS 把它挂到另一个根下，失败就重新找根再试；
+ * - 挂接方向由下标的哈希优先级决定（低优先级挂到高优先级下），
+ *   相当于随机合并，期望树高 O(log n)，且不需要维护 size/rank。
+ *
+ * 路径减半只会把指针改成指向更高的祖先，而祖先优先级严格递增，
+ * 因此和并发的 unite 交错时也不会成环。
+ */
+class ConcurrentDisjointSet
+{
+   private:
+    int n;
+    std::unique_ptr<std::atomic<uint32_t>[]> parent;
+    std::atomic<int> sets;
+
+    // 下标的随机优先级（整数哈希，相同下标结果固定），相同时按下标比较
+    static uint32_t priority(uint32_t x)
+    {
+        x ^= x >> 16;
+        x *= 0x7feb352dU;
+        x ^= x >> 15;
+        x *= 0x846ca68bU;
+        x ^= x >> 16;
+        return x;
+    }
+
+    static bool lower(uint32_t a, uint32_t b)
+    {
+        uint32_t pa = priority(a), pb = priority(b);
+        return pa != pb ? pa < pb : a < b;
+    }
+
+   public:
+    explicit ConcurrentDisjointSet(int n) : n(n), parent(new std::atomic<uint32_t>[n]), sets(n)
+    {
+        for (int i = 0; i < n; i++)
+        {
+            parent[i].store(static_cast<uint32_t>(i), std::memory_order_relaxed);
+        }
+    }
+
+    int size() const
+    {
+        return n;
+    }
+
+    // 查找根，同时用 CAS 做路径减半
+    int find(int x)
+    {
+        uint32_t u = static_cast<uint32_t>(x);
+        while (true)
+        {
+            uint32_t p = parent[u].load(std::memory_order_acquire);
+            if (p == u) return static_cast<int>(u);
+            uint32_t gp = parent[p].load(std::memory_order_acquire);
+            if (gp != p)
+            {
+                // 失败说明别的线程已经把 u 指得更高了，不用重试
+                parent[u].compare_exchange_weak(p, gp, std::memory_order_release,
+                                                std::memory_order_relaxed);
+            }
+            u = gp;
+        }
+    }
+
+    // 合并 x 和 y 所在的集合；本次调用真正完成合并时返回 true
+    bool unite(int x, int y)
+    {
+        while (true)
+        {
+            uint32_t rx = static_cast<uint32_t>(find(x));
+            uint32_t ry = static_cast<uint32_t>(find(y));
+            if (rx == ry) return false;
+            if (lower(ry, rx)) std::swap(rx, ry);  // rx 优先级低，挂到 ry 下
+            uint32_t expected = rx;
+            if (parent[rx].compare_exchange_strong(expected, ry, std::memory_order_acq_rel))
+            {
+                sets.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+            // rx 已经被别的线程挂走，重新查找
+        }
+    }
+
+    /**
+     * @brief 判断 x 和 y 是否在同一集合
+     *
+     * 两次 find 之间根可能被并发合并。如果根不同但 rx 仍然是根，
+     * 说明在读取 rx 的那一刻两者确实不在同一集合，结果可线性化；否则重试。
+     */
+    bool sameSet(int x, int y)
+    {
+        while (true)
+        {
+            int rx = find(x), ry = find(y);
+            if (rx == ry) return true;
+            if (parent[rx].load(std::memory_order_acquire) == static_cast<uint32_t>(rx))
+            {
+                return false;
+            }
+        }
+    }
+
+    // 当前集合个数（并发修改期间只是一个近似快照）
+    int setCount() const
+    {
+        return sets.load(std::memory_order_relaxed);
+    }
+};
+
+#endif  // CONCURRENTDISJOINTSET_H
@@ -0,0 +1,132 @@
+// DynamicConnectivity.h
+#ifndef DYNAMICCONNECTIVITY_H
+#define DYNAMICCONNECTIVITY_H
+
+#include <algorithm>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "RollbackDisjointSet.h"
+
+/**
+ * @file DynamicConnectivity.h
+ * @brief 离线动态连通性：支持加边、删边和连通查询
+ *
+ * 做法（线段树分治）：
+ * 1. 先扫一遍操作，算出每条边“存活”的时间区间 [加入时刻, 删除时刻)；
+ * 2. 把每个区间挂到时间线段树上 O(log q) 个节点；
+ * 3. DFS 线段树，进入节点时把挂在上面的边合并进可撤销并查集，
+ *    到叶子时回答该时刻的查询，离开节点时撤销本节点的合并。
+ *
+ * 总复杂度 O((n + q) log q log n)。
+ */
+
+// 操作类型与 homework17/2.cpp 的 z 对应：1 合并（加边），2 查询，3 删边
+enum class ConnOpType
+{
+    Add = 1,
+    Query = 2,
+    Remove = 3
+};
+
+struct ConnOp
+{
+    ConnOpType type;
+    int x, y;
+};
+
+class DynamicConnectivity
+{
+   private:
+    int n;
+    int q;
+    std::vector<std::vector<std::pair<int, int>>> tree;  // 每个线段树节点上挂的边
+    const std::vector<ConnOp>* ops = nullptr;
+    std::vector<bool> answers;
+    RollbackDisjointSet dsu;
+
+    // 把边 e 挂到覆盖 [l, r) 的线段树节点上
+    void insert(int node, int nl, int nr, int l, int r, const std::pair<int, int>& e)
+    {
+        if (r <= nl || nr <= l) return;
+        if (l <= nl && nr <= r)
+        {
+            tree[node].push_back(e);
+            return;
+        }
+        int mid = (nl + nr) / 2;
+        insert(2 * node, nl, mid, l, r, e);
+        insert(2 * node + 1, mid, nr, l, r, e);
+    }
+
+    void dfs(int node, int nl, int nr)
+    {
+        int version = dsu.snapshot();
+        for (const auto& [u, v] : tree[node]) dsu.unite(u, v);
+        if (nr - nl == 1)
+        {
+            const ConnOp& op = (*ops)[nl];
+            if (op.type == ConnOpType::Query)
+            {
+                answers.push_back(dsu.sameSet(op.x, op.y));
+            }
+        }
+        else
+        {
+            int mid = (nl + nr) / 2;
+            dfs(2 * node, nl, mid);
+            dfs(2 * node + 1, mid, nr);
+        }
+        dsu.rollback(version);
+    }
+
+   public:
+    explicit DynamicConnectivity(int n) : n(n), q(0), dsu(n)
+    {
+    }
+
+    /**
+     * @brief 按顺序处理操作序列，返回所有查询的答案（true 表示连通）
+     *
+     * 无向边 (x, y) 与 (y, x) 视为同一条；同一条边可以重复加入，
+     * 每次删除只抵消最近一次加入；删除不存在的边会被忽略。
+     */
+    std::vector<bool> solve(const std::vector<ConnOp>& operations)
+    {
+        ops = &operations;
+        q = static_cast<int>(operations.size());
+        answers.clear();
+        if (q == 0) return answers;
+        tree.assign(4 * q, {});
+        dsu = RollbackDisjointSet(n);
+
+        std::map<std::pair<int, int>, std::vector<int>> alive;  // 边 -> 尚未删除的加入时刻
+        for (int t = 0; t < q; t++)
+        {
+            const ConnOp& op = operations[t];
+            std::pair<int, int> e = std::minmax(op.x, op.y);
+            if (op.type == ConnOpType::Add)
+            {
+                alive[e].push_back(t);
+            }
+            else if (op.type == ConnOpType::Remove)
+            {
+                auto it = alive.find(e);
+                if (it == alive.end() || it->second.empty()) continue;
+                insert(1, 0, q, it->second.back(), t, e);
+                it->second.pop_back();
+            }
+        }
+        for (const auto& [e, starts] : alive)
+        {
+            for (int start : starts) insert(1, 0, q, start, q, e);
+        }
+
+        dfs(1, 0, q);
+        tree.clear();
+        return answers;
+    }
+};
+
+#endif  // DYNAMICCONNECTIVITY_H
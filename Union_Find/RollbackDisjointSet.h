@@ -0,0 +1,83 @@
+// RollbackDisjointSet.h
+#ifndef ROLLBACKDISJOINTSET_H
+#define ROLLBACKDISJOINTSET_H
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/**
+ * @file RollbackDisjointSet.h
+ * @brief 可撤销并查集：按大小合并，不做路径压缩，用栈记录每次合并
+ *
+ * 不压缩路径，find 每次都是 O(log n)，但每次 unite 只改动两个位置，
+ * 可以按栈的顺序原样撤销。布局与 DisjointSet 相同：node[x] < 0 表示根，-node[x] 为集合大小。
+ */
+class RollbackDisjointSet
+{
+   private:
+    std::vector<int32_t> node;
+    // 每次成功合并压入 (被挂接的根, 它原来的 node 值)，撤销时按原样恢复
+    std::vector<std::pair<int32_t, int32_t>> history;
+    int sets;
+
+   public:
+    explicit RollbackDisjointSet(int n = 0) : node(n, -1), sets(n)
+    {
+    }
+
+    int find(int x) const
+    {
+        while (node[x] >= 0) x = node[x];
+        return x;
+    }
+
+    bool sameSet(int x, int y) const
+    {
+        return find(x) == find(y);
+    }
+
+    // 合并成功返回 true；失败时不压栈，调用方不需要为它撤销
+    bool unite(int x, int y)
+    {
+        int rx = find(x), ry = find(y);
+        if (rx == ry) return false;
+        if (node[rx] > node[ry]) std::swap(rx, ry);  // rx 是较大的集合
+        history.push_back({ry, node[ry]});
+        node[rx] += node[ry];
+        node[ry] = rx;
+        sets--;
+        return true;
+    }
+
+    // 当前的版本号，配合 rollback 使用
+    int snapshot() const
+    {
+        return static_cast<int>(history.size());
+    }
+
+    // 撤销合并直到回到 snapshot() 返回的版本
+    void rollback(int version)
+    {
+        while (static_cast<int>(history.size()) > version)
+        {
+            auto [child, old] = history.back();
+            history.pop_back();
+            node[node[child]] -= old;
+            node[child] = old;
+            sets++;
+        }
+    }
+
+    int setSize(int x) const
+    {
+        return -node[find(x)];
+    }
+
+    int setCount() const
+    {
+        return sets;
+    }
+};
+
+#endif  // ROLLBACKDISJOINTSET_H
@@ -0,0 +1,165 @@
+// 排序基准测试：各种排序算法 × 各种输入分布 × 10 到 maxN 的规模
+//
+// 编译：g++ -std=c++20 -O2 -pthread bench_sort.cpp Sort_Methods/QuickSort.cpp Sort_Methods/Merge_Sort.cpp -o bench_sort
+// 运行：./bench_sort [maxN=10000000] [csv=bench_sort.csv] [seed=2024]
+//
+// 每个 (算法, 分布, n) 组合测若干个样本，每个样本把同一份输入复制 batch 份依次排序，
+// 报告每个元素的平均耗时（ns/elem）和样本间的标准差，结果同时写入 CSV。
+// 输入由固定种子生成，不同算法拿到的是完全相同的数据。n = 10^9 时需要约 8 GB 内存。
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Sort_Methods/Merge.h"
+#include "Sort_Methods/ParallelMergeSort.h"
+#include "Sort_Methods/ParallelQuickSort.h"
+#include "Sort_Methods/ParallelSampleSort.h"
+#include "Sort_Methods/PowerSort.h"
+#include "Sort_Methods/Quick.h"
+#include "Sort_Methods/RadixSort.h"
+using namespace std;
+
+// 原来的朴素快排（取最右元素做 pivot），作为对照；有序、逆序、重复值多时退化为 O(n^2)
+int naivePartition(vector<int>& a, int left, int right)
+{
+    int pivot = a[right];
+    int i = left, j = right;
+    while (i < j)
+    {
+        while (i < j && a[i] <= pivot) i++;
+        while (i < j && a[j] >= pivot) j--;
+        if (i < j) swap(a[i], a[j]);
+    }
+    swap(a[i], a[right]);
+    return i;
+}
+
+void naiveQuicksort(vector<int>& a, int left, int right)
+{
+    if (left >= right) return;
+    int p = naivePartition(a, left, right);
+    naiveQuicksort(a, left, p - 1);
+    naiveQuicksort(a, p + 1, right);
+}
+
+struct SortEntry
+{
+    string name;
+    function<void(vector<int>&)> run;
+    // 返回 false 表示这个组合不测（例如朴素快排在退化输入上会栈溢出）
+    function<bool(const string&, long long)> accepts = [](const string&, long long) { return true; };
+};
+
+// Zipf(s=1) 分布，取值 1..kZipfValues，用累积分布表二分抽样
+vector<int> zipfSample(int n, mt19937_64& rng)
+{
+    const int kZipfValues = 100000;
+    vector<double> cdf(kZipfValues);
+    double sum = 0;
+    for (int k = 1; k <= kZipfValues; k++) cdf[k - 1] = sum += 1.0 / k;
+    uniform_real_distribution<double> u(0, sum);
+    vector<int> a(n);
+    for (int& x : a) x = static_cast<int>(lower_bound(cdf.begin(), cdf.end(), u(rng)) - cdf.begin()) + 1;
+    return a;
+}
+
+vector<int> makeDistribution(const string& kind, int n, unsigned seed)
+{
+    mt19937_64 rng(seed);
+    vector<int> a(n);
+    if (kind == "zipf") return zipfSample(n, rng);
+    for (int i = 0; i < n; i++)
+    {
+        if (kind == "random") a[i] = static_cast<int>(rng());
+        else if (kind == "sorted") a[i] = i;
+        else if (kind == "reversed") a[i] = n - i;
+        else if (kind == "organ-pipe") a[i] = i < n / 2 ? i : n - i;
+        else if (kind == "few-unique") a[i] = static_cast<int>(rng() % 16);
+        else a[i] = i;  // nearly-sorted：先有序，下面再随机交换 1%
+    }
+    if (kind == "nearly-sorted")
+    {
+        for (int k = 0; k < n / 100; k++) swap(a[rng() % n], a[rng() % n]);
+    }
+    return a;
+}
+
+int main(int argc, char* argv[])
+{
+    long long maxN = argc > 1 ? stoll(argv[1]) : 10000000;
+    string csvPath = argc > 2 ? argv[2] : "bench_sort.csv";
+    unsigned seed = argc > 3 ? static_cast<unsigned>(stoul(argv[3])) : 2024;
+
+    WorkStealingPool pool;
+    vector<SortEntry> sorts = {
+        {"naiveQuicksort", [](vector<int>& a) { naiveQuicksort(a, 0, static_cast<int>(a.size()) - 1); },
+         [](const string& kind, long long n) { return kind == "random" ? n <= 10000000 : n <= 10000; }},
+        {"quickSort", [](vector<int>& a) { quickSort(a, 0, static_cast<int>(a.size()) - 1); }},
+        {"Mergesort", [](vector<int>& a) { Mergesort(a, 0, static_cast<int>(a.size()) - 1); }},
+        {"Mergesort InPlace",
+         [](vector<int>& a) { Mergesort(a, 0, static_cast<int>(a.size()) - 1, MergeSortMemory::InPlace); }},
+        {"std::sort", [](vector<int>& a) { sort(a.begin(), a.end()); }},
+        {"std::stable_sort", [](vector<int>& a) { stable_sort(a.begin(), a.end()); }},
+        {"powerSort", [](vector<int>& a) { powerSort(a.begin(), a.end()); }},
+        {"radixSort", [](vector<int>& a) { radixSort(a.begin(), a.end()); }},
+        {"parallelQuickSort", [&pool](vector<int>& a) { parallelQuickSort(pool, a.begin(), a.end()); }},
+        {"parallelMergeSort", [&pool](vector<int>& a) { parallelMergeSort(pool, a.begin(), a.end()); }},
+        {"parallelSampleSort", [&pool](vector<int>& a) { parallelSampleSort(pool, a.begin(), a.end()); }},
+    };
+    vector<string> kinds = {"random", "sorted", "reversed", "organ-pipe", "few-unique", "nearly-sorted", "zipf"};
+
+    ofstream csv(csvPath);
+    csv << "sort,distribution,n,samples,batch,mean_ns_per_elem,stddev_ns_per_elem,min_ns_per_elem\n";
+    cout << fixed << setprecision(2);
+    cout << "线程数 " << pool.size() << "，结果写入 " << csvPath << endl;
+
+    for (long long n = 10; n <= maxN; n *= 10)
+    {
+        // 小规模每个样本排多份，摊薄计时误差；大规模减少样本数
+        long long batch = max(1LL, 100000 / n);
+        int samples = n >= 100000000 ? 3 : n >= 10000000 ? 5 : 7;
+        for (const string& kind : kinds)
+        {
+            vector<int> input = makeDistribution(kind, static_cast<int>(n), seed + static_cast<unsigned>(n));
+            cout << "\nn = " << n << "，" << kind << endl;
+            for (const SortEntry& s : sorts)
+            {
+                if (!s.accepts(kind, n))
+                {
+                    cout << "  " << setw(20) << left << s.name << right << "跳过" << endl;
+                    continue;
+                }
+                vector<double> perElem;
+                bool correct = true;
+                for (int rep = 0; rep < samples; rep++)
+                {
+                    vector<vector<int>> copies(batch, input);
+                    auto t0 = chrono::steady_clock::now();
+                    for (vector<int>& c : copies) s.run(c);
+                    auto t1 = chrono::steady_clock::now();
+                    perElem.push_back(chrono::duration<double, nano>(t1 - t0).count() / (batch * n));
+                    correct = correct && is_sorted(copies[0].begin(), copies[0].end());
+                }
+                double mean = 0, var = 0;
+                for (double x : perElem) mean += x;
+                mean /= samples;
+                for (double x : perElem) var += (x - mean) * (x - mean);
+                double stddev = samples > 1 ? sqrt(var / (samples - 1)) : 0;
+                double best = *min_element(perElem.begin(), perElem.end());
+
+                cout << "  " << setw(20) << left << s.name << right << setw(10) << mean << " ns/elem  ± "
+                     << setw(6) << stddev << "  (min " << best << ")" << (correct ? "" : "  结果错误!") << endl;
+                csv << s.name << ',' << kind << ',' << n << ',' << samples << ',' << batch << ',' << mean << ','
+                    << stddev << ',' << best << '\n';
+            }
+        }
+    }
+    return 0;
+}
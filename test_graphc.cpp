@@ -0,0 +1,206 @@
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <queue>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "Graph/graphc.h"
+using namespace std;
+
+// 用普通邻接表做参照，检查压缩图的邻居、first/next 和 BFS 结果
+int main()
+{
+    cout << "Testing Graphc (group-varint compressed adjacency):" << endl;
+
+    int n = 2000;
+    mt19937 rng(42);
+    vector<pair<int, int>> edges;
+    for (int i = 0; i < 20000; i++)
+    {
+        int u = rng() % n;
+        // 一半是局部边，一半是远距离边，覆盖 1~4 字节的 gap
+        int v = (i % 2 == 0) ? (u + 1 + rng() % 8) % n : rng() % n;
+        edges.push_back({u, v});
+    }
+
+    vector<vector<int>> ref(n);
+    for (auto [u, v] : edges)
+    {
+        ref[u].push_back(v);
+        if (u != v) ref[v].push_back(u);
+    }
+    size_t csrEdges = 0;
+    for (auto& list : ref)
+    {
+        sort(list.begin(), list.end());
+        list.erase(unique(list.begin(), list.end()), list.end());
+        csrEdges += list.size();
+    }
+
+    Graphc g(n, edges);
+
+    // Test case 1: 邻居列表
+    bool ok = true;
+    vector<int> got;
+    for (int v = 0; v < n; v++)
+    {
+        g.neighbors(v, got);
+        if (got != ref[v] || g.degree(v) != (int)ref[v].size()) ok = false;
+    }
+    cout << "neighbors() matches reference" << (ok ? " ✓" : " ✗") << endl;
+
+    // Test case 2: first/next 迭代
+    ok = true;
+    for (int v = 0; v < n; v += 7)
+    {
+        vector<int> it;
+        for (int w = g.first(v); w < g.n(); w = g.next(v, w)) it.push_back(w);
+        if (it != ref[v]) ok = false;
+    }
+    cout << "first/next matches reference" << (ok ? " ✓" : " ✗") << endl;
+
+    // Test case 3: isEdge / weight
+    ok = g.isEdge(edges[0].first, edges[0].second) && g.weight(edges[0].second, edges[0].first) == 1;
+    cout << "isEdge/weight on existing edge" << (ok ? " ✓" : " ✗") << endl;
+
+    // Test case 4: BFS 距离
+    vector<int> d1(n, -1), d2(n, -1);
+    queue<int> q;
+    d1[0] = 0;
+    q.push(0);
+    while (!q.empty())
+    {
+        int u = q.front();
+        q.pop();
+        for (int w : ref[u])
+            if (d1[w] == -1) d1[w] = d1[u] + 1, q.push(w);
+    }
+    d2[0] = 0;
+    q.push(0);
+    while (!q.empty())
+    {
+        int u = q.front();
+        q.pop();
+        g.forEachNeighbor(u, [&](int w) {
+            if (d2[w] == -1) d2[w] = d2[u] + 1, q.push(w);
+        });
+    }
+    cout << "BFS distances match" << (d1 == d2 ? " ✓" : " ✗") << endl;
+
+    // Test case 5: 不可修改
+    bool threw = false;
+    try
+    {
+        g.setEdge(0, 1, 1);
+    }
+    catch (const logic_error&)
+    {
+        threw = true;
+    }
+    cout << "setEdge throws on compressed graph" << (threw ? " ✓" : " ✗") << endl;
+
+    size_t csrBytes = (n + 1) * sizeof(int) + csrEdges * sizeof(int);
+    cout << "CSR bytes: " << csrBytes << ", compressed bytes: " << g.memoryBytes() << endl;
+
+    // Test case 6: 通过 Graph 接口的递归 DFS，多个顶点的 first/next 交错进行；isEdge 与参照一致
+    {
+        vector<int> order1, order2;
+        vector<char> seen(n, 0);
+        function<void(int)> dfsRef = [&](int v) {
+            seen[v] = 1;
+            order1.push_back(v);
+            for (int w : ref[v])
+                if (!seen[w]) dfsRef(w);
+        };
+        function<void(int)> dfs = [&](int v) {
+            g.setMark(v, 1);
+            order2.push_back(v);
+            for (int w = g.first(v); w < g.n(); w = g.next(v, w))
+                if (g.getMark(w) == 0) dfs(w);
+        };
+        dfsRef(0);
+        dfs(0);
+        ok = order1 == order2;
+        for (int v = 0; v < n; v += 13)
+            for (int j = 0; j < n; j += 17)
+                ok = ok && g.isEdge(v, j) == binary_search(ref[v].begin(), ref[v].end(), j);
+        cout << "interleaved first/next DFS and isEdge match reference" << (ok ? " ✓" : " ✗") << endl;
+    }
+
+    // Test case 7: 高度数的中心顶点让后面顶点的块偏移超出 16 位增量，走溢出表
+    {
+        int hubN = 80000;
+        vector<pair<int, int>> star;
+        for (int v = 1; v < hubN; v++) star.push_back({0, v});
+        for (int v = 1; v + 1 < 200; v++) star.push_back({v, v + 1});
+        Graphc hub(hubN, star);
+        ok = hub.degree(0) == hubN - 1;
+        for (int v = 1; v < 200 && ok; v++)
+        {
+            vector<int> expected = {0};
+            if (v > 1) expected.push_back(v - 1);
+            if (v + 1 < 200) expected.push_back(v + 1);
+            hub.neighbors(v, got);
+            ok = got == expected;
+        }
+        hub.neighbors(hubN - 1, got);
+        ok = ok && got == vector<int>{0};
+        cout << "block offsets past the 16-bit delta range" << (ok ? " ✓" : " ✗") << endl;
+    }
+
+    // Test case 8: 大图上 BFS 计时，压缩图对比普通 CSR 数组（目标：慢不超过约 30%）
+    {
+        int bigN = 1 << 20;
+        vector<pair<int, int>> bigEdges;
+        for (int i = 0; i < 8 * bigN; i++)
+        {
+            int u = rng() % bigN;
+            int v = (i % 4 != 0) ? (u + 1 + rng() % 64) % bigN : rng() % bigN;
+            bigEdges.push_back({u, v});
+        }
+        Graphc big(bigN, bigEdges);
+        vector<int> start(bigN + 1, 0), adj;
+        vector<int> list;
+        for (int v = 0; v < bigN; v++)
+        {
+            big.neighbors(v, list);
+            adj.insert(adj.end(), list.begin(), list.end());
+            start[v + 1] = static_cast<int>(adj.size());
+        }
+
+        vector<int> dist(bigN), bfsQueue(bigN);
+        auto timeBfs = [&](auto&& visit) {
+            double best = 1e18;
+            for (int rep = 0; rep < 5; rep++)
+            {
+                auto t0 = chrono::steady_clock::now();
+                fill(dist.begin(), dist.end(), -1);
+                int head = 0, tail = 0;
+                dist[0] = 0;
+                bfsQueue[tail++] = 0;
+                while (head < tail)
+                {
+                    int u = bfsQueue[head++];
+                    visit(u, [&](int w) {
+                        if (dist[w] == -1) dist[w] = dist[u] + 1, bfsQueue[tail++] = w;
+                    });
+                }
+                best = min(best, chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count());
+            }
+            return best;
+        };
+        double csrMs = timeBfs([&](int u, auto&& f) {
+            for (int k = start[u]; k < start[u + 1]; k++) f(adj[k]);
+        });
+        vector<int> csrDist = dist;
+        double compressedMs = timeBfs([&](int u, auto&& f) { big.forEachNeighbor(u, f); });
+        size_t bigCsrBytes = start.size() * sizeof(int) + adj.size() * sizeof(int);
+        cout << "BFS on " << bigN << " vertices / " << adj.size() << " arcs: CSR " << csrMs << " ms ("
+             << bigCsrBytes << " bytes), compressed " << compressedMs << " ms (" << big.memoryBytes()
+             << " bytes), ratio " << compressedMs / csrMs << (dist == csrDist ? " ✓" : " ✗") << endl;
+    }
+    return 0;
+}
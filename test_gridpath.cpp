@@ -0,0 +1,230 @@
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <queue>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Grid/GridPath.h"
+#include "Grid/MazeIndex.h"
+#include "Grid/WeightedPath.h"
+using namespace std;
+
+// 检查一条路径是否从 s 出发、逐格相邻、不穿墙并到达 t
+bool validPath(const GridMap& m, const vector<int>& p, int s, int t, int d)
+{
+    if ((int)p.size() != d + 1 || p.front() != s || p.back() != t) return false;
+    for (size_t i = 1; i < p.size(); i++)
+    {
+        int step = abs(p[i] / m.cols - p[i - 1] / m.cols) + abs(p[i] % m.cols - p[i - 1] % m.cols);
+        if (step != 1 || m.cell[p[i]] == 1) return false;
+    }
+    return true;
+}
+
+// 参照实现：普通二叉堆 Dijkstra，不可达返回 -1
+long long dijkstra(const CostGrid& g, int s, int t)
+{
+    if (g.cost[s] < 0 || g.cost[t] < 0) return -1;
+    vector<long long> dist(g.cost.size(), -1);
+    priority_queue<pair<long long, int>, vector<pair<long long, int>>, greater<>> pq;
+    dist[s] = 0;
+    pq.push({0, s});
+    int dr[] = {-1, 1, 0, 0}, dc[] = {0, 0, -1, 1};
+    while (!pq.empty())
+    {
+        auto [d, u] = pq.top();
+        pq.pop();
+        if (d != dist[u]) continue;
+        if (u == t) return d;
+        for (int k = 0; k < 4; k++)
+        {
+            int r = u / g.cols + dr[k], c = u % g.cols + dc[k];
+            if (r < 0 || r >= g.rows || c < 0 || c >= g.cols || g.cost[g.index(r, c)] < 0) continue;
+            int v = g.index(r, c);
+            if (dist[v] == -1 || d + g.cost[v] < dist[v])
+            {
+                dist[v] = d + g.cost[v];
+                pq.push({dist[v], v});
+            }
+        }
+    }
+    return -1;
+}
+
+int main()
+{
+    cout << "测试网格寻路：" << endl;
+
+    // 测试用例1：PTAtest/9.cpp 风格的迷宫，3 为起点，4 为终点
+    {
+        vector<vector<int>> maze = {{3, 0, 1, 0},  //
+                                    {1, 0, 1, 0},
+                                    {0, 0, 0, 0},
+                                    {0, 1, 1, 4}};
+        GridMap m(4, 4);
+        int s = -1, t = -1;
+        for (int i = 0; i < 4; i++)
+            for (int j = 0; j < 4; j++)
+            {
+                m.cell[m.index(i, j)] = maze[i][j];
+                if (maze[i][j] == 3) s = m.index(i, j);
+                if (maze[i][j] == 4) t = m.index(i, j);
+            }
+        GridPathFinder f(m);
+        vector<int> path;
+        int d = f.jumpPointSearch(s, t, &path);
+        cout << "迷宫最短路: 结果=" << d << ", 期望=6";
+        cout << (d == 6 && validPath(m, path, s, t, d) ? " ✓" : " ✗") << endl;
+    }
+
+    // 测试用例2：随机地图上四种算法与 BFS 一致
+    {
+        mt19937 rng(7);
+        int mismatch = 0;
+        for (int it = 0; it < 2000; it++)
+        {
+            int R = 1 + rng() % 16, C = 1 + rng() % 16;
+            GridMap m(R, C);
+            for (auto& x : m.cell) x = (rng() % 100) < 30;
+            int s = rng() % (R * C), t = rng() % (R * C);
+            m.cell[s] = 3, m.cell[t] = 4;
+
+            GridPathFinder f(m);
+            int expected = f.bfs(s, t);
+            vector<int> p1, p2, p3;
+            int d1 = f.bidirectionalBFS(s, t, &p1);
+            int d2 = f.aStar(s, t, &p2);
+            int d3 = f.jumpPointSearch(s, t, &p3);
+            if (d1 != expected || d2 != expected || d3 != expected) mismatch++;
+            else if (expected >= 0 && !(validPath(m, p1, s, t, expected) &&
+                                        validPath(m, p2, s, t, expected) &&
+                                        validPath(m, p3, s, t, expected)))
+                mismatch++;
+        }
+        cout << "随机地图 2000 组, 不一致=" << mismatch << (mismatch == 0 ? " ✓" : " ✗") << endl;
+    }
+
+    // 测试用例3：不可达
+    {
+        GridMap m(1, 3);
+        m.cell = {3, 1, 4};
+        GridPathFinder f(m);
+        int d = f.aStar(0, 2);
+        cout << "被墙隔开: 结果=" << d << ", 期望=-1" << (d == -1 ? " ✓" : " ✗") << endl;
+    }
+
+    // 测试用例4：带代价的地图，绕开高代价的格子
+    {
+        CostGrid g(3, 3);
+        g.cost = {1, 9, 1,  //
+                  1, 9, 1,
+                  1, 1, 1};
+        WeightedGridPath w(g);
+        vector<int> path;
+        long long d = w.shortestPath(0, 2, &path);
+        cout << "加权最短路: 结果=" << d << ", 期望=6" << (d == 6 && path.size() == 7 ? " ✓" : " ✗")
+             << endl;
+    }
+
+    // 测试用例5：随机代价下 0-1 BFS / Dial / 基数堆 / shortestPath 都与二叉堆 Dijkstra 一致
+    {
+        mt19937 rng(9);
+        int mismatch = 0;
+        for (int it = 0; it < 1500; it++)
+        {
+            int R = 1 + rng() % 16, C = 1 + rng() % 16;
+            int maxCost = it % 3 == 0 ? 1 : (it % 3 == 1 ? 20 : 100000);
+            CostGrid g(R, C);
+            for (auto& x : g.cost) x = (rng() % 100) < 25 ? -1 : (int)(rng() % (maxCost + 1));
+            int s = rng() % (R * C), t = rng() % (R * C);
+            WeightedGridPath w(g);
+            long long expected = dijkstra(g, s, t);
+            if (w.shortestPath(s, t) != expected) mismatch++;
+            if (w.radixHeap(s, t) != expected) mismatch++;
+            if (maxCost <= WeightedGridPath::kDialMaxCost && w.dial(s, t) != expected) mismatch++;
+            if (maxCost == 1 && w.zeroOneBFS(s, t) != expected) mismatch++;
+        }
+        cout << "随机加权地图 1500 组, 不一致=" << mismatch << (mismatch == 0 ? " ✓" : " ✗") << endl;
+    }
+
+    // 测试用例6：距离场索引（地标 + 固定目标），存盘后重新读入结果不变
+    {
+        mt19937 rng(21);
+        int mismatch = 0;
+        for (int it = 0; it < 200; it++)
+        {
+            int R = 2 + rng() % 20, C = 2 + rng() % 20;
+            GridMap m(R, C);
+            for (auto& x : m.cell) x = (rng() % 100) < 30;
+            m.cell[0] = 0;
+            MazeIndex index(m);
+            index.buildLandmarks(3, 0);
+            index.buildTargets({0});
+
+            string file = "/tmp/test_maze_index.bin";
+            index.save(file);
+            MazeIndex loaded(m);
+            loaded.load(file);
+
+            GridPathFinder f(m);
+            for (int q = 0; q < 20; q++)
+            {
+                int s = rng() % (R * C), t = q % 4 == 0 ? 0 : rng() % (R * C);
+                int expected = f.bfs(s, t);
+                if (index.query(s, t) != expected || loaded.query(s, t) != expected) mismatch++;
+            }
+        }
+        cout << "距离场索引 4000 次查询, 不一致=" << mismatch << (mismatch == 0 ? " ✓" : " ✗") << endl;
+
+        // 地图改变后读入旧索引应当报错
+        GridMap other(2, 2);
+        MazeIndex wrong(other);
+        bool threw = false;
+        try
+        {
+            wrong.load("/tmp/test_maze_index.bin");
+        }
+        catch (const runtime_error&)
+        {
+            threw = true;
+        }
+        cout << "地图不匹配时拒绝读入" << (threw ? " ✓" : " ✗") << endl;
+
+        // 截断或源点数损坏的文件：抛异常，已经读入的索引保持可用
+        {
+            GridMap m(6, 6);
+            MazeIndex index(m);
+            index.buildLandmarks(2, 0);
+            index.save("/tmp/test_maze_index.bin");
+            ifstream in("/tmp/test_maze_index.bin", ios::binary);
+            string bytes((istreambuf_iterator<char>(in)), istreambuf_iterator<char>());
+            in.close();
+
+            MazeIndex loaded(m);
+            loaded.buildTargets({35});
+            bool ok = true;
+            string truncated = bytes.substr(0, bytes.size() - 10), hugeCount = bytes;
+            hugeCount[4 * 4 + 8 + 3] = '\x7f';  // 源点数的最高字节
+            for (const string& corrupt : {truncated, hugeCount})
+            {
+                ofstream("/tmp/test_maze_index_bad.bin", ios::binary) << corrupt;
+                bool failed = false;
+                try
+                {
+                    loaded.load("/tmp/test_maze_index_bad.bin");
+                }
+                catch (const runtime_error&)
+                {
+                    failed = true;
+                }
+                ok = ok && failed && loaded.sourceCount() == 1 && loaded.query(0, 35) == 10;
+            }
+            remove("/tmp/test_maze_index_bad.bin");
+            cout << "损坏的索引文件不破坏已有索引" << (ok ? " ✓" : " ✗") << endl;
+        }
+    }
+    return 0;
+}
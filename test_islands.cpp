@@ -0,0 +1,167 @@
+#include <algorithm>
+#include <iostream>
+#include <queue>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#include "Grid/FloodFill.h"
+#include "Grid/Islands.h"
+#include "Grid/ParallelLabel.h"
+#include "Grid/StreamIslands.h"
+using namespace std;
+
+// 参照实现：与 Leetcode/200.nums_of_Islands.cpp 相同的逐格 BFS
+int bfsIslands(vector<vector<char>> grid)
+{
+    int m = grid.size(), n = m ? grid[0].size() : 0, count = 0;
+    for (int i = 0; i < m; i++)
+        for (int j = 0; j < n; j++)
+        {
+            if (grid[i][j] != '1') continue;
+            count++;
+            queue<pair<int, int>> q;
+            q.push({i, j});
+            grid[i][j] = '0';
+            while (!q.empty())
+            {
+                auto [a, b] = q.front();
+                q.pop();
+                int dx[4] = {-1, 1, 0, 0}, dy[4] = {0, 0, -1, 1};
+                for (int k = 0; k < 4; k++)
+                {
+                    int x = a + dx[k], y = b + dy[k];
+                    if (x >= 0 && x < m && y >= 0 && y < n && grid[x][y] == '1')
+                    {
+                        grid[x][y] = '0';
+                        q.push({x, y});
+                    }
+                }
+            }
+        }
+    return count;
+}
+
+vector<vector<char>> randomGrid(mt19937& rng, int m, int n, int density)
+{
+    vector<vector<char>> g(m, vector<char>(n));
+    for (auto& row : g)
+        for (auto& c : row) c = (int)(rng() % 100) < density ? '1' : '0';
+    return g;
+}
+
+int main()
+{
+    cout << "测试岛屿计数：" << endl;
+
+    // 测试用例1：LeetCode 示例
+    {
+        vector<vector<char>> grid = {{'1', '1', '0', '0', '0'},
+                                     {'1', '1', '0', '0', '0'},
+                                     {'0', '0', '1', '0', '0'},
+                                     {'0', '0', '0', '1', '1'}};
+        int result = numIslands(BitGrid::fromChars(grid));
+        cout << "LeetCode 示例: 结果=" << result << ", 期望=3" << (result == 3 ? " ✓" : " ✗") << endl;
+    }
+
+    // 测试用例2：随机网格，列数跨过 64 位字边界
+    {
+        mt19937 rng(11);
+        int mismatch = 0;
+        for (int it = 0; it < 300; it++)
+        {
+            int m = 1 + rng() % 40, n = 1 + rng() % 200;
+            auto grid = randomGrid(rng, m, n, 20 + rng() % 60);
+            if (numIslands(BitGrid::fromChars(grid)) != bfsIslands(grid)) mismatch++;
+        }
+        cout << "随机网格 300 组, 不一致=" << mismatch << (mismatch == 0 ? " ✓" : " ✗") << endl;
+    }
+
+    // 测试用例3：分块并行标记，块很小以便覆盖大量块边界
+    {
+        mt19937 rng(13);
+        int mismatch = 0;
+        for (int it = 0; it < 200; it++)
+        {
+            int m = 1 + rng() % 60, n = 1 + rng() % 150;
+            auto grid = randomGrid(rng, m, n, 30 + rng() % 40);
+            ComponentLabels cl = labelComponents(BitGrid::fromChars(grid), 4, 7, 9);
+            bool ok = cl.count == bfsIslands(grid);
+            vector<bool> used(cl.count + 1, false);
+            for (int i = 0; i < m && ok; i++)
+                for (int j = 0; j < n && ok; j++)
+                {
+                    uint32_t l = cl.label[i * n + j];
+                    ok = (l != 0) == (grid[i][j] == '1') && (int)l <= cl.count;
+                    used[l] = true;
+                    if (l && j + 1 < n && grid[i][j + 1] == '1') ok = ok && cl.label[i * n + j + 1] == l;
+                    if (l && i + 1 < m && grid[i + 1][j] == '1') ok = ok && cl.label[(i + 1) * n + j] == l;
+                }
+            for (int l = 1; l <= cl.count && ok; l++) ok = used[l];
+            if (!ok) mismatch++;
+        }
+        cout << "分块并行标记 200 组, 不一致=" << mismatch << (mismatch == 0 ? " ✓" : " ✗") << endl;
+    }
+
+    // 测试用例4：逐行流式计数，岛屿数和面积都与整体标记的结果一致
+    {
+        mt19937 rng(17);
+        int mismatch = 0;
+        for (int it = 0; it < 200; it++)
+        {
+            int m = 1 + rng() % 50, n = 1 + rng() % 150;
+            auto grid = randomGrid(rng, m, n, 30 + rng() % 40);
+            stringstream ss;
+            for (auto& row : grid)
+            {
+                // 用空格分隔列，检查分隔符会被跳过
+                for (char c : row) ss << c << ' ';
+                ss << '\n';
+            }
+            vector<long long> areas;
+            long long count = countIslandsStream(ss, [&areas](long long a) { areas.push_back(a); });
+
+            ComponentLabels cl = labelComponents(BitGrid::fromChars(grid), 1);
+            vector<long long> expected(cl.count, 0);
+            for (uint32_t l : cl.label)
+                if (l) expected[l - 1]++;
+            sort(areas.begin(), areas.end());
+            sort(expected.begin(), expected.end());
+            if (count != cl.count || areas != expected) mismatch++;
+        }
+        cout << "流式计数 200 组, 不一致=" << mismatch << (mismatch == 0 ? " ✓" : " ✗") << endl;
+    }
+
+    // 测试用例5：扫描线填充，char 网格和 BitGrid 的结果都与逐格 BFS 一致
+    {
+        mt19937 rng(19);
+        int mismatch = 0;
+        for (int it = 0; it < 1000; it++)
+        {
+            int m = 1 + rng() % 30, n = 1 + rng() % 150;
+            auto grid = randomGrid(rng, m, n, 40 + rng() % 40);
+            int r = rng() % m, c = rng() % n;
+            BitGrid bits = BitGrid::fromChars(grid);
+            auto filled = grid;
+            long long k1 = floodFill(filled, r, c);
+            long long k2 = floodFill(bits, r, c);
+            // 种子所在的岛被整块填掉，其余岛屿不受影响
+            int before = bfsIslands(grid), after = bfsIslands(filled);
+            bool ok = k1 == k2 && after == before - (grid[r][c] == '1');
+            for (int i = 0; i < m && ok; i++)
+                for (int j = 0; j < n && ok; j++) ok = bits.get(i, j) == (filled[i][j] == '1');
+            if (!ok) mismatch++;
+        }
+        cout << "扫描线填充 1000 组, 不一致=" << mismatch << (mismatch == 0 ? " ✓" : " ✗") << endl;
+    }
+
+    // 测试用例6：一千万格的单个大岛，不会爆栈
+    {
+        int m = 2000, n = 5000;
+        vector<vector<char>> grid(m, vector<char>(n, '1'));
+        long long k = floodFill(grid, m / 2, n / 2);
+        cout << "单个大岛填充: 结果=" << k << ", 期望=" << (long long)m * n
+             << (k == (long long)m * n ? " ✓" : " ✗") << endl;
+    }
+    return 0;
+}
@@ -0,0 +1,484 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Sort_Methods/ExternalSort.h"
+#include "Sort_Methods/KeySort.h"
+#include "Sort_Methods/Merge.h"
+#include "Sort_Methods/ParallelMergeSort.h"
+#include "Sort_Methods/ParallelQuickSort.h"
+#include "Sort_Methods/ParallelSampleSort.h"
+#include "Sort_Methods/PowerSort.h"
+#include "Sort_Methods/Quick.h"
+#include "Sort_Methods/RadixSort.h"
+#include "Sort_Methods/SortingNetwork.h"
+using namespace std;
+
+// Search/QuickSearch.cpp
+int quickSelect(vector<int>& a, int left, int right, int k);
+
+// 生成几种容易让朴素快排退化的输入
+vector<int> makeInput(const string& kind, int n, mt19937& rng)
+{
+    vector<int> a(n);
+    for (int i = 0; i < n; i++)
+    {
+        if (kind == "random") a[i] = rng();
+        else if (kind == "sorted") a[i] = i;
+        else if (kind == "reversed") a[i] = n - i;
+        else if (kind == "equal") a[i] = 7;
+        else if (kind == "organ") a[i] = i < n / 2 ? i : n - i;
+        else a[i] = rng() % 4;  // few-unique
+    }
+    return a;
+}
+
+int main()
+{
+    cout << "测试排序：" << endl;
+    mt19937 rng(2024);
+    vector<string> kinds = {"random", "sorted", "reversed", "equal", "organ", "few-unique"};
+    vector<int> sizes = {0, 1, 2, 15, 17, 100, 1000, 200000};
+
+    // 测试用例1：quickSort（vector<int> 接口）在各种分布下与 std::sort 一致
+    for (const string& kind : kinds)
+    {
+        bool ok = true;
+        for (int n : sizes)
+        {
+            vector<int> a = makeInput(kind, n, rng), expected = a;
+            sort(expected.begin(), expected.end());
+            quickSort(a, 0, n - 1);
+            ok = ok && a == expected;
+        }
+        cout << "quickSort " << kind << (ok ? " ✓" : " ✗") << endl;
+    }
+
+    // 测试用例2：模板接口，自定义比较器和非 int 元素
+    {
+        vector<string> words = {"pear", "apple", "fig", "banana", "kiwi", "cherry"};
+        vector<string> expected = words;
+        sort(expected.begin(), expected.end(), greater<>());
+        introSort(words.begin(), words.end(), greater<>());
+        cout << "introSort 字符串降序" << (words == expected ? " ✓" : " ✗") << endl;
+    }
+
+    // 测试用例3：partition（quickSelect 用的块分区）返回的位置左边不大于、右边不小于 pivot
+    {
+        bool ok = true;
+        for (int it = 0; it < 2000 && ok; it++)
+        {
+            int n = 1 + rng() % 500;
+            vector<int> a = makeInput(kinds[it % kinds.size()], n, rng);
+            int left = rng() % n, right = left + rng() % (n - left);
+            vector<int> before = a;
+            int p = partition(a, left, right);
+            ok = p >= left && p <= right;
+            for (int i = left; i < p && ok; i++) ok = a[i] <= a[p];
+            for (int i = p + 1; i <= right && ok; i++) ok = a[i] >= a[p];
+            sort(before.begin() + left, before.begin() + right + 1);
+            vector<int> after = a;
+            sort(after.begin() + left, after.begin() + right + 1);
+            ok = ok && before == after;
+        }
+        cout << "partition 分区性质" << (ok ? " ✓" : " ✗") << endl;
+    }
+
+    // 测试用例4：parallelQuickSort，规模足够大时会走并行分区
+    for (const string& kind : kinds)
+    {
+        bool ok = true;
+        for (int n : {0, 1, 1000, 100000, 2000000})
+        {
+            vector<int> a = makeInput(kind, n, rng), expected = a;
+            sort(expected.begin(), expected.end());
+            parallelQuickSort(a, 0, n - 1, 4);
+            ok = ok && a == expected;
+        }
+        cout << "parallelQuickSort " << kind << (ok ? " ✓" : " ✗") << endl;
+    }
+
+    // 测试用例5：同一个线程池重复使用，自定义比较器
+    {
+        WorkStealingPool pool(3);
+        bool ok = true;
+        for (int round = 0; round < 3; round++)
+        {
+            vector<int> a = makeInput("random", 300000, rng), expected = a;
+            sort(expected.begin(), expected.end(), greater<>());
+            parallelQuickSort(pool, a.begin(), a.end(), greater<>());
+            ok = ok && a == expected;
+        }
+        cout << "parallelQuickSort 复用线程池" << (ok ? " ✓" : " ✗") << endl;
+    }
+
+    // 测试用例5.1：parallelSampleSort，线程数多于桶的一半、重复值很多（走相等桶）、自定义比较器
+    {
+        bool ok = true;
+        for (int threads : {2, 5, 33})
+        {
+            WorkStealingPool pool(threads);
+            for (const string& kind : kinds)
+            {
+                for (int n : {0, 1, 1000, 2000000})
+                {
+                    vector<int> a = makeInput(kind, n, rng), expected = a;
+                    sort(expected.begin(), expected.end());
+                    parallelSampleSort(pool, a.begin(), a.end());
+                    ok = ok && a == expected;
+                }
+            }
+            vector<string> words(500000);
+            for (string& w : words) w = to_string(rng() % 100000);
+            vector<string> expected = words;
+            sort(expected.begin(), expected.end(), greater<>());
+            parallelSampleSort(pool, words.begin(), words.end(), greater<>());
+            ok = ok && words == expected;
+        }
+        vector<int> a = makeInput("random", 1000000, rng), expected = a;
+        sort(expected.begin(), expected.end());
+        parallelSampleSort(a, 0, static_cast<int>(a.size()) - 1, 4);
+        ok = ok && a == expected;
+        cout << "parallelSampleSort 各种分布与线程数" << (ok ? " ✓" : " ✗") << endl;
+    }
+
+    // 测试用例6：Mergesort（vector<int> 接口），覆盖奇数趟和偶数趟
+    for (const string& kind : kinds)
+    {
+        bool ok = true;
+        for (int n : {0, 1, 2, 31, 33, 64, 65, 1000, 4097, 200000})
+        {
+            vector<int> a = makeInput(kind, n, rng), expected = a;
+            sort(expected.begin(), expected.end());
+            Mergesort(a, 0, n - 1);
+            ok = ok && a == expected;
+        }
+        cout << "Mergesort " << kind << (ok ? " ✓" : " ✗") << endl;
+    }
+
+    // 测试用例6.1：Mergesort 的 InPlace 模式；再只按 first 比较，检查分块归并的稳定性
+    {
+        bool ok = true;
+        for (const string& kind : kinds)
+        {
+            for (int n : {0, 1, 2, 33, 1000, 4097, 200000})
+            {
+                vector<int> a = makeInput(kind, n, rng), expected = a;
+                sort(expected.begin(), expected.end());
+                Mergesort(a, 0, n - 1, MergeSortMemory::InPlace);
+                ok = ok && a == expected;
+            }
+        }
+        auto byKey = [](const pair<int, int>& x, const pair<int, int>& y) { return x.first < y.first; };
+        for (int it = 0; it < 300 && ok; it++)
+        {
+            int n = rng() % 50000, keys = it % 3 == 0 ? 5 : 100000;
+            vector<pair<int, int>> a(n);
+            for (int i = 0; i < n; i++) a[i] = {static_cast<int>(rng() % keys), i};
+            vector<pair<int, int>> expected = a;
+            stable_sort(expected.begin(), expected.end(), byKey);
+            inPlaceMergeSort(a.begin(), a.end(), byKey);
+            ok = a == expected;
+        }
+        cout << "Mergesort InPlace 与稳定性" << (ok ? " ✓" : " ✗") << endl;
+    }
+
+    // 测试用例7：bottomUpMergeSort 稳定性：只按 first 比较，结果应与 stable_sort 完全相同
+    {
+        bool ok = true;
+        auto byKey = [](const pair<int, int>& x, const pair<int, int>& y) { return x.first < y.first; };
+        for (int n : {5, 100, 3000, 50000})
+        {
+            vector<pair<int, int>> a(n);
+            for (int i = 0; i < n; i++) a[i] = {static_cast<int>(rng() % 10), i};
+            vector<pair<int, int>> expected = a;
+            stable_sort(expected.begin(), expected.end(), byKey);
+            bottomUpMergeSort(a.begin(), a.end(), byKey);
+            ok = ok && a == expected;
+        }
+        cout << "bottomUpMergeSort 稳定性" << (ok ? " ✓" : " ✗") << endl;
+    }
+
+    // 测试用例8：parallelMergeSort 在不同线程数下都与 stable_sort 完全相同
+    {
+        bool ok = true;
+        auto byKey = [](const pair<int, int>& x, const pair<int, int>& y) { return x.first < y.first; };
+        for (int threads : {2, 3, 8})
+        {
+            for (int n : {1000, 40000, 1000000})
+            {
+                vector<pair<int, int>> a(n);
+                for (int i = 0; i < n; i++) a[i] = {static_cast<int>(rng() % 100), i};
+                vector<pair<int, int>> expected = a;
+                stable_sort(expected.begin(), expected.end(), byKey);
+                parallelMergeSort(a.begin(), a.end(), byKey, threads);
+                ok = ok && a == expected;
+            }
+        }
+        for (const string& kind : kinds)
+        {
+            vector<int> a = makeInput(kind, 300000, rng), expected = a;
+            sort(expected.begin(), expected.end());
+            parallelMergeSort(a, 0, static_cast<int>(a.size()) - 1, 4);
+            ok = ok && a == expected;
+        }
+        cout << "parallelMergeSort 稳定性与各种分布" << (ok ? " ✓" : " ✗") << endl;
+    }
+
+    // 测试用例9：radixSort，含负数、64 位、小值域（会跳过大部分趟）
+    {
+        bool ok = true;
+        for (const string& kind : kinds)
+        {
+            for (int n : {0, 1, 63, 64, 1000, 70000, 200000})
+            {
+                vector<int> a = makeInput(kind, n, rng), expected = a;
+                sort(expected.begin(), expected.end());
+                radixSort(a, 0, n - 1);
+                ok = ok && a == expected;
+            }
+        }
+        mt19937_64 rng64(7);
+        for (int n : {100, 100000})
+        {
+            vector<int64_t> a(n);
+            vector<uint64_t> b(n);
+            vector<int16_t> c(n);
+            for (int i = 0; i < n; i++)
+            {
+                a[i] = static_cast<int64_t>(rng64());
+                b[i] = rng64() % 1000;
+                c[i] = static_cast<int16_t>(rng64());
+            }
+            vector<int64_t> ea = a;
+            vector<uint64_t> eb = b;
+            vector<int16_t> ec = c;
+            sort(ea.begin(), ea.end());
+            sort(eb.begin(), eb.end());
+            sort(ec.begin(), ec.end());
+            radixSort(a.begin(), a.end());
+            radixSort(b.begin(), b.end());
+            radixSort(c.begin(), c.end());
+            ok = ok && a == ea && b == eb && c == ec;
+        }
+        cout << "radixSort 各种整数类型" << (ok ? " ✓" : " ✗") << endl;
+    }
+
+    // 测试用例10：partition3 返回的 [lo, hi] 恰好是等于 pivot 的一段
+    {
+        bool ok = true;
+        for (int it = 0; it < 2000 && ok; it++)
+        {
+            int n = 1 + rng() % 300;
+            vector<int> a = makeInput(kinds[it % kinds.size()], n, rng);
+            int left = rng() % n, right = left + rng() % (n - left);
+            vector<int> before = a;
+            auto [lo, hi] = partition3(a, left, right);
+            ok = left <= lo && lo <= hi && hi <= right;
+            for (int i = left; i < lo && ok; i++) ok = a[i] < a[lo];
+            for (int i = lo; i <= hi && ok; i++) ok = a[i] == a[lo];
+            for (int i = hi + 1; i <= right && ok; i++) ok = a[i] > a[lo];
+            sort(before.begin() + left, before.begin() + right + 1);
+            vector<int> after = a;
+            sort(after.begin() + left, after.begin() + right + 1);
+            ok = ok && before == after;
+        }
+        cout << "partition3 三路分区性质" << (ok ? " ✓" : " ✗") << endl;
+    }
+
+    // 测试用例11：quickSelect 在大量重复值下仍然正确
+    {
+        bool ok = true;
+        for (const string& kind : kinds)
+        {
+            vector<int> a = makeInput(kind, 5000, rng), sorted = a;
+            sort(sorted.begin(), sorted.end());
+            for (int k : {0, 1, 2500, 4998, 4999})
+            {
+                vector<int> b = a;
+                ok = ok && quickSelect(b, 0, static_cast<int>(b.size()) - 1, k) == sorted[k];
+            }
+        }
+        cout << "quickSelect 各种分布" << (ok ? " ✓" : " ✗") << endl;
+    }
+
+    // 测试用例12：排序网络，0 到 64 的每种长度，以及成批排序
+    {
+        bool ok = true;
+        for (int it = 0; it < 20000 && ok; it++)
+        {
+            int n = it % (kSortNetworkMax + 1);
+            vector<int> a = makeInput(kinds[it % kinds.size()], n, rng), expected = a;
+            for (int& x : a) x -= it % 2 == 0 ? 0 : 1 << 30;  // 混入负数
+            for (int& x : expected) x -= it % 2 == 0 ? 0 : 1 << 30;
+            sort(expected.begin(), expected.end());
+            sortNetwork(a.data(), n);
+            ok = a == expected;
+        }
+        for (int blockSize : {8, 16, 32, 64})
+        {
+            vector<int> a = makeInput("random", blockSize * 50, rng), expected = a;
+            for (int b = 0; b < 50; b++) sort(expected.begin() + b * blockSize, expected.begin() + (b + 1) * blockSize);
+            sortNetworkBlocks(a.data(), 50, blockSize);
+            ok = ok && a == expected;
+        }
+        cout << "sortNetwork 各种长度" << (ok ? " ✓" : " ✗") << endl;
+    }
+
+    // 测试用例13：externalSort，预算很小，逼出多个有序段和多趟归并
+    {
+        struct Record
+        {
+            int key;
+            int payload[2];
+        };
+        string dir = filesystem::temp_directory_path().string();
+        string input = dir + "/test_sort_input.bin", output = dir + "/test_sort_output.bin";
+        bool ok = true;
+        for (int n : {0, 1, 5000, 200000})
+        {
+            vector<Record> records(n);
+            for (int i = 0; i < n; i++) records[i] = {static_cast<int>(rng() % 100000), {i, -i}};
+            FILE* f = fopen(input.c_str(), "wb");
+            fwrite(records.data(), sizeof(Record), n, f);
+            fclose(f);
+
+            ExternalSortOptions options;
+            options.memoryBudget = 48 << 10;  // 48 KB：200000 条记录约 2.4 MB，会产生几十个段
+            options.ioBlockBytes = 4 << 10;
+            auto byKey = [](const Record& a, const Record& b) { return a.key < b.key; };
+            externalSort<Record>(input, output, byKey, options);
+
+            vector<Record> sorted(n + 1);
+            f = fopen(output.c_str(), "rb");
+            size_t got = fread(sorted.data(), sizeof(Record), n + 1, f);
+            fclose(f);
+            ok = ok && got == static_cast<size_t>(n);
+            sorted.resize(got);
+            ok = ok && is_sorted(sorted.begin(), sorted.end(), byKey);
+            // 每条记录原样保留：按 payload[0] 还原后与输入逐条相同
+            vector<int> seen(n, 0);
+            for (const Record& r : sorted)
+            {
+                int i = r.payload[0];
+                ok = ok && i >= 0 && i < n && !seen[i] && r.key == records[i].key && r.payload[1] == -i;
+                if (i >= 0 && i < n) seen[i] = 1;
+            }
+        }
+        // 末尾有不完整的记录：应当报错，而不是悄悄丢掉
+        {
+            FILE* f = fopen(input.c_str(), "wb");
+            Record r = {1, {2, 3}};
+            fwrite(&r, sizeof(Record), 1, f);
+            fwrite(&r, 3, 1, f);
+            fclose(f);
+            bool threw = false;
+            try
+            {
+                externalSort<Record>(input, output, [](const Record& a, const Record& b) { return a.key < b.key; });
+            }
+            catch (const invalid_argument&)
+            {
+                threw = true;
+            }
+            ok = ok && threw;
+        }
+        remove(input.c_str());
+        remove(output.c_str());
+        cout << "externalSort 多趟归并" << (ok ? " ✓" : " ✗") << endl;
+    }
+
+    // 测试用例14：sortByKey / sortPermutation，窄记录、宽记录、浮点键、字符串键、bool 和 long double 键，结果与 stable_sort 相同
+    {
+        struct Edge
+        {
+            int u, v, w;
+        };
+        struct Wide
+        {
+            double weight;
+            int id;
+            string name;
+        };
+        bool ok = true;
+        for (int n : {0, 1, 50, 5000, 100000})
+        {
+            vector<Edge> edges(n);
+            for (int i = 0; i < n; i++) edges[i] = {i, static_cast<int>(rng() % 100), static_cast<int>(rng() % 1000) - 500};
+            vector<Edge> expected = edges;
+            stable_sort(expected.begin(), expected.end(), [](const Edge& a, const Edge& b) { return a.w < b.w; });
+            sortByKey(edges, [](const Edge& e) { return e.w; });
+            for (int i = 0; i < n && ok; i++) ok = edges[i].u == expected[i].u && edges[i].w == expected[i].w;
+
+            vector<Wide> wide(n);
+            for (int i = 0; i < n; i++) wide[i] = {static_cast<double>(rng() % 200) / 8 - 12.5, i, to_string(rng() % 50)};
+            vector<Wide> byWeight = wide, byName = wide;
+            stable_sort(byWeight.begin(), byWeight.end(), [](const Wide& a, const Wide& b) { return a.weight < b.weight; });
+            stable_sort(byName.begin(), byName.end(), [](const Wide& a, const Wide& b) { return a.name < b.name; });
+            vector<uint32_t> perm = sortPermutation(wide, [](const Wide& w) { return w.weight; });
+            for (int i = 0; i < n && ok; i++) ok = wide[perm[i]].id == byWeight[i].id;
+            sortByKey(wide, [](const Wide& w) { return w.name; });
+            for (int i = 0; i < n && ok; i++) ok = wide[i].id == byName[i].id;
+
+            // bool、long double 键不能基数排序，走归并分支
+            vector<Edge> byFlag = edges, flagExpected = edges;
+            auto flag = [](const Edge& e) { return e.v % 3 == 0; };
+            stable_sort(flagExpected.begin(), flagExpected.end(),
+                        [&](const Edge& a, const Edge& b) { return flag(a) < flag(b); });
+            sortByKey(byFlag, flag);
+            for (int i = 0; i < n && ok; i++) ok = byFlag[i].u == flagExpected[i].u;
+            vector<Edge> byLong = edges, longExpected = edges;
+            auto longKey = [](const Edge& e) { return static_cast<long double>(e.v) / 7 - 3; };
+            stable_sort(longExpected.begin(), longExpected.end(),
+                        [&](const Edge& a, const Edge& b) { return longKey(a) < longKey(b); });
+            sortByKey(byLong, longKey);
+            perm = sortPermutation(edges, longKey);
+            for (int i = 0; i < n && ok; i++)
+                ok = byLong[i].u == longExpected[i].u && edges[perm[i]].u == longExpected[i].u;
+        }
+        cout << "sortByKey 各种键和记录" << (ok ? " ✓" : " ✗") << endl;
+    }
+
+    // 测试用例15：powerSort 稳定性，输入由若干升序、降序段拼成，并带少量随机交换
+    {
+        bool ok = true;
+        auto byKey = [](const pair<int, int>& x, const pair<int, int>& y) { return x.first < y.first; };
+        for (int it = 0; it < 300 && ok; it++)
+        {
+            int n = rng() % 20000;
+            vector<pair<int, int>> a(n);
+            for (int i = 0, run = 0; i < n; run++)
+            {
+                int len = 1 + rng() % 2000, base = rng() % 1000;
+                bool descending = run % 2 == 1;
+                for (int k = 0; k < len && i < n; k++, i++)
+                    a[i] = {descending ? base - k / 3 : base + k / 3, i};
+            }
+            for (int k = 0; k < n / 500; k++) swap(a[rng() % n], a[rng() % n]);
+            vector<pair<int, int>> expected = a;
+            stable_sort(expected.begin(), expected.end(), byKey);
+            powerSort(a.begin(), a.end(), byKey);
+            ok = a == expected;
+        }
+        for (const string& kind : kinds)
+        {
+            vector<int> a = makeInput(kind, 100000, rng), expected = a;
+            sort(expected.begin(), expected.end());
+            powerSort(a, 0, static_cast<int>(a.size()) - 1);
+            ok = ok && a == expected;
+        }
+        // 已经有序时只需 n - 1 次比较
+        long long comparisons = 0;
+        vector<int> sorted = makeInput("sorted", 100000, rng);
+        powerSort(sorted.begin(), sorted.end(), [&](int x, int y) { return comparisons++, x < y; });
+        ok = ok && comparisons == 99999;
+        cout << "powerSort 稳定性与自适应" << (ok ? " ✓" : " ✗") << endl;
+    }
+    return 0;
+}